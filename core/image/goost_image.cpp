@@ -1,4 +1,5 @@
 #include "goost_image.h"
+#include "image_utils.h"
 
 #include "modules/modules_enabled.gen.h"
 #ifdef MODULE_SVG_ENABLED
@@ -9,132 +10,474 @@
 #include "goost/thirdparty/hqx/HQ3x.hh"
 #include "goost/thirdparty/leptonica/allheaders.h"
 
+#include "core/hash_map.h"
 #include "core/local_vector.h"
+#include "core/os/os.h"
+#include "core/project_settings.h"
+
+// Not worth the overhead of starting threads for smaller images.
+static const int PARALLEL_MIN_PIXELS = 256 * 256;
+
+int image_get_8bit_pixel_size(Image::Format p_format) {
+	switch (p_format) {
+		case Image::FORMAT_L8:
+		case Image::FORMAT_R8:
+			return 1;
+		case Image::FORMAT_LA8:
+		case Image::FORMAT_RG8:
+			return 2;
+		case Image::FORMAT_RGB8:
+			return 3;
+		case Image::FORMAT_RGBA8:
+			return 4;
+		default:
+			return 0;
+	}
+}
 
-void GoostImage::replace_color(Ref<Image> p_image, const Color &p_color, const Color &p_with_color) {
-	ERR_FAIL_COND(p_image.is_null());
+PoolVector<uint8_t> image_encode_pixel(Image::Format p_format, const Color &p_color) {
+	Ref<Image> image = memnew(Image);
+	image->create(1, 1, false, p_format);
+	image->lock();
+	image->set_pixel(0, 0, p_color);
+	image->unlock();
+	return image->get_data();
+}
 
-	if (p_color == p_with_color) {
-		return;
+bool image_get_pixel_range(Image::Format p_format, const Color &p_color, real_t p_tolerance, PixelRange &r_range) {
+	// Byte offset of each decoded color component, or -1 if the component
+	// decodes to a constant: 0 for color channels, 1 for alpha.
+	int channels[4] = { -1, -1, -1, -1 };
+	switch (p_format) {
+		case Image::FORMAT_L8: {
+			channels[0] = channels[1] = channels[2] = 0;
+		} break;
+		case Image::FORMAT_LA8: {
+			channels[0] = channels[1] = channels[2] = 0;
+			channels[3] = 1;
+		} break;
+		case Image::FORMAT_R8: {
+			channels[0] = 0;
+		} break;
+		case Image::FORMAT_RG8: {
+			channels[0] = 0;
+			channels[1] = 1;
+		} break;
+		case Image::FORMAT_RGB8: {
+			channels[0] = 0;
+			channels[1] = 1;
+			channels[2] = 2;
+		} break;
+		case Image::FORMAT_RGBA8: {
+			channels[0] = 0;
+			channels[1] = 1;
+			channels[2] = 2;
+			channels[3] = 3;
+		} break;
+		default: {
+			ERR_FAIL_V(false);
+		}
+	}
+	const real_t tolerance = MAX(0.0, p_tolerance);
+	int lo[4] = { 0, 0, 0, 0 };
+	int hi[4] = { 255, 255, 255, 255 };
+
+	for (int i = 0; i < 4; ++i) {
+		const real_t c = p_color[i];
+		if (channels[i] < 0) {
+			const real_t constant = i == 3 ? 1.0 : 0.0;
+			if (Math::abs(constant - c) > tolerance) {
+				return false;
+			}
+			continue;
+		}
+		const int b = channels[i];
+		lo[b] = MAX(lo[b], (int)Math::ceil((c - tolerance) * 255.0 - CMP_EPSILON));
+		hi[b] = MIN(hi[b], (int)Math::floor((c + tolerance) * 255.0 + CMP_EPSILON));
+		if (lo[b] > hi[b]) {
+			return false;
+		}
 	}
+	for (int i = 0; i < 4; ++i) {
+		r_range.lo[i] = lo[i];
+		r_range.hi[i] = hi[i];
+	}
+	return true;
+}
 
-	p_image->lock();
+int image_get_thread_count(int p_width, int p_height) {
+	if (int64_t(p_width) * p_height < PARALLEL_MIN_PIXELS) {
+		return 1;
+	}
+	int count = OS::get_singleton()->get_processor_count();
+	const int max_count = GLOBAL_GET("goost/image/max_threads");
+	if (max_count > 0) {
+		count = MIN(count, max_count);
+	}
+	return CLAMP(count, 1, p_height);
+}
 
-	for (int y = 0; y < p_image->get_height(); ++y) {
-		for (int x = 0; x < p_image->get_width(); ++x) {
-			if (p_image->get_pixel(x, y) == p_color) {
-				p_image->set_pixel(x, y, p_with_color);
+// Replaces colors in rows of an image, see `GoostImage::replace_colors()`.
+struct _ReplaceColors {
+	int width = 0;
+
+	// Formats which cannot be compared per byte, the image must be locked.
+	Image *image = nullptr;
+	const Color *colors = nullptr;
+	const Color *with_colors = nullptr;
+	int color_count = 0;
+	real_t tolerance = 0.0;
+
+	// Raw data of images with 8 bits per channel.
+	uint8_t *data = nullptr;
+	int pixel_size = 0;
+	const PixelRange *ranges = nullptr;
+	const uint32_t *replacements = nullptr;
+	int range_count = 0;
+	bool exact = false;
+	const HashMap<uint32_t, uint32_t> *table = nullptr;
+
+	void replace_pixels(int p_from, int p_to) {
+		for (int y = p_from; y < p_to; ++y) {
+			for (int x = 0; x < width; ++x) {
+				const Color pixel = image->get_pixel(x, y);
+				for (int i = 0; i < color_count; ++i) {
+					const Color &c = colors[i];
+					if (Math::abs(pixel.r - c.r) <= tolerance && Math::abs(pixel.g - c.g) <= tolerance &&
+							Math::abs(pixel.b - c.b) <= tolerance && Math::abs(pixel.a - c.a) <= tolerance) {
+						image->set_pixel(x, y, with_colors[i]);
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	void process_rows(int p_band, int p_from, int p_to) {
+		if (image) {
+			replace_pixels(p_from, p_to);
+			return;
+		}
+		const int begin = p_from * width;
+		const int end = p_to * width;
+
+		if (exact && range_count == 1 && pixel_size == 4) {
+			// Packed compare and select, auto-vectorized by compilers.
+			uint32_t from = 0;
+			memcpy(&from, ranges[0].lo, 4);
+			const uint32_t to = replacements[0];
+			uint32_t *px = (uint32_t *)data;
+			for (int i = begin; i < end; ++i) {
+				px[i] = px[i] == from ? to : px[i];
+			}
+		} else if (exact) {
+			for (int i = begin; i < end; ++i) {
+				uint8_t *p = &data[i * pixel_size];
+				uint32_t key = 0;
+				memcpy(&key, p, pixel_size);
+				const uint32_t *to = table->getptr(key);
+				if (to) {
+					memcpy(p, to, pixel_size);
+				}
+			}
+		} else {
+			for (int i = begin; i < end; ++i) {
+				uint8_t *p = &data[i * pixel_size];
+				for (int j = 0; j < range_count; ++j) {
+					if (ranges[j].has(p, pixel_size)) {
+						memcpy(p, &replacements[j], pixel_size);
+						break;
+					}
+				}
 			}
 		}
 	}
-	p_image->unlock();
+};
+
+void GoostImage::replace_color(Ref<Image> p_image, const Color &p_color, const Color &p_with_color, real_t p_tolerance) {
+	ERR_FAIL_COND(p_image.is_null());
+
+	if (p_color == p_with_color && p_tolerance <= 0.0) {
+		return;
+	}
+	Vector<Color> colors;
+	colors.push_back(p_color);
+	Vector<Color> with_colors;
+	with_colors.push_back(p_with_color);
+
+	replace_colors(p_image, colors, with_colors, p_tolerance);
 }
 
-struct BucketFillQueue {
-	LocalVector<Vector2> array;
-	uint32_t front = 0;
-	uint32_t back = 0;
+void GoostImage::replace_colors(Ref<Image> p_image, const Vector<Color> &p_colors, const Vector<Color> &p_with_colors, real_t p_tolerance) {
+	ERR_FAIL_COND(p_image.is_null());
+	ERR_FAIL_COND_MSG(p_colors.size() != p_with_colors.size(), "The number of colors to replace must match the number of replacement colors.");
+	ERR_FAIL_COND_MSG(p_image->is_compressed(), "Cannot replace colors in compressed image.");
 
-	_FORCE_INLINE_ void push_back(const Vector2 &p_point) {
-		array.push_back(p_point);
-		++back;
+	if (p_image->empty() || p_colors.empty()) {
+		return;
+	}
+	const int width = p_image->get_width();
+	const int height = p_image->get_height();
+	const Image::Format format = p_image->get_format();
+	const int pixel_size = image_get_8bit_pixel_size(format);
+	const int thread_count = image_get_thread_count(width, height);
+
+	_ReplaceColors job;
+	job.width = width;
+
+	if (pixel_size == 0) {
+		// Formats which cannot be compared per byte.
+		job.image = p_image.ptr();
+		job.colors = p_colors.ptr();
+		job.with_colors = p_with_colors.ptr();
+		job.color_count = p_colors.size();
+		job.tolerance = MAX(0.0, p_tolerance);
+
+		p_image->lock();
+		image_process_rows(&job, height, thread_count);
+		p_image->unlock();
+		return;
+	}
+	// Colors are matched against ranges of raw bytes, so pixels never need
+	// to be decoded. Colors which can't occur in the image are skipped.
+	LocalVector<PixelRange> ranges;
+	LocalVector<uint32_t> replacements;
+	bool exact = true;
+
+	for (int i = 0; i < p_colors.size(); ++i) {
+		PixelRange range;
+		if (!image_get_pixel_range(format, p_colors[i], p_tolerance, range)) {
+			continue;
+		}
+		const PoolVector<uint8_t> encoded = image_encode_pixel(format, p_with_colors[i]);
+		uint32_t replacement = 0;
+		memcpy(&replacement, encoded.read().ptr(), pixel_size);
+
+		for (int j = 0; j < pixel_size; ++j) {
+			exact = exact && range.lo[j] == range.hi[j];
+		}
+		ranges.push_back(range);
+		replacements.push_back(replacement);
 	}
-	_FORCE_INLINE_ Vector2 pop_front() {
-		return array[front++];
+	if (ranges.empty()) {
+		return;
 	}
-	_FORCE_INLINE_ bool is_empty() {
-		return front == back;
+	// Lookup table for palettes, first color wins.
+	HashMap<uint32_t, uint32_t> table;
+	if (exact && !(ranges.size() == 1 && pixel_size == 4)) {
+		for (uint32_t i = 0; i < ranges.size(); ++i) {
+			uint32_t key = 0;
+			memcpy(&key, ranges[i].lo, pixel_size);
+			if (!table.has(key)) {
+				table.set(key, replacements[i]);
+			}
+		}
+	}
+	job.pixel_size = pixel_size;
+	job.ranges = ranges.ptr();
+	job.replacements = replacements.ptr();
+	job.range_count = ranges.size();
+	job.exact = exact;
+	job.table = &table;
+
+	PoolVector<uint8_t> data = p_image->get_data();
+	{
+		PoolVector<uint8_t>::Write w = data.write();
+		job.data = w.ptr();
+		image_process_rows(&job, height, thread_count);
+	}
+	p_image->create(width, height, p_image->has_mipmaps(), format, data);
+}
+
+// Compares raw pixel bytes of 8-bit per channel formats.
+struct _FillMatchRaw {
+	const uint8_t *data = nullptr;
+	int pixel_size = 0;
+	uint8_t seed[4] = {};
+	int threshold = 0;
+
+	_FORCE_INLINE_ bool operator()(int p_ofs) const {
+		const uint8_t *p = &data[p_ofs * pixel_size];
+		for (int i = 0; i < pixel_size; ++i) {
+			if (ABS(int(p[i]) - int(seed[i])) > threshold) {
+				return false;
+			}
+		}
+		return true;
 	}
 };
 
-// Based on flood-fill algorithm.
-// Scanline could perform better for 4-connected case, but this runs up to
-// x35 faster compared to equivalent GDScript implementation in any case.
-Ref<Image> GoostImage::bucket_fill(Ref<Image> p_image, const Point2 &p_at, const Color &p_fill_color, bool p_fill_image, Connectivity p_con) {
-	ERR_FAIL_COND_V(p_image.is_null(), Ref<Image>());
-	ERR_FAIL_COND_V(p_image->empty(), Ref<Image>());
+// Fallback for other uncompressed formats.
+struct _FillMatchColor {
+	const Image *image = nullptr;
+	int width = 0;
+	Color seed;
+	real_t tolerance = 0.0;
+
+	_FORCE_INLINE_ bool operator()(int p_ofs) const {
+		const Color c = image->get_pixel(p_ofs % width, p_ofs / width);
+		return Math::abs(c.r - seed.r) <= tolerance && Math::abs(c.g - seed.g) <= tolerance &&
+				Math::abs(c.b - seed.b) <= tolerance && Math::abs(c.a - seed.a) <= tolerance;
+	}
+};
 
-	if (!has_pixelv(p_image, p_at)) {
-		return Ref<Image>();
+// Span-based flood fill. Each popped seed is extended to a horizontal span,
+// and runs of matching pixels in the rows above and below are pushed as new
+// seeds, one per run. The mask doubles as a visited set, filled pixels are 255.
+template <class M>
+static void _scanline_fill(int p_width, int p_height, const Point2i &p_at, bool p_diagonal, const M &p_match, uint8_t *r_mask) {
+	LocalVector<Point2i> stack;
+	stack.push_back(p_at);
+
+	while (!stack.empty()) {
+		const Point2i p = stack[stack.size() - 1];
+		stack.resize(stack.size() - 1);
+
+		const int row = p.y * p_width;
+		if (r_mask[row + p.x] || !p_match(row + p.x)) {
+			continue;
+		}
+		int x1 = p.x;
+		while (x1 > 0 && !r_mask[row + x1 - 1] && p_match(row + x1 - 1)) {
+			--x1;
+		}
+		int x2 = p.x;
+		while (x2 < p_width - 1 && !r_mask[row + x2 + 1] && p_match(row + x2 + 1)) {
+			++x2;
+		}
+		memset(&r_mask[row + x1], 255, x2 - x1 + 1);
+
+		const int from = p_diagonal ? MAX(0, x1 - 1) : x1;
+		const int to = p_diagonal ? MIN(p_width - 1, x2 + 1) : x2;
+
+		for (int ny = p.y - 1; ny <= p.y + 1; ny += 2) {
+			if (ny < 0 || ny >= p_height) {
+				continue;
+			}
+			const int nrow = ny * p_width;
+			bool in_span = false;
+			for (int x = from; x <= to; ++x) {
+				const bool inside = !r_mask[nrow + x] && p_match(nrow + x);
+				if (inside && !in_span) {
+					stack.push_back(Point2i(x, ny));
+				}
+				in_span = inside;
+			}
+		}
 	}
-	p_image->lock();
+}
 
-	Color filling_color = p_image->get_pixelv(p_at);
+// Writes 255 to the mask for each pixel connected to `p_at` and similar to it.
+static void _bucket_fill_mask(const Ref<Image> &p_image, const Point2i &p_at, real_t p_tolerance, GoostImage::Connectivity p_con, PoolVector<uint8_t> &r_mask) {
+	const int width = p_image->get_width();
+	const int height = p_image->get_height();
+	const bool diagonal = p_con == GoostImage::EIGHT_CONNECTED;
 
-	int width = p_image->get_width();
-	int height = p_image->get_height();
-	bool mipmaps = p_image->has_mipmaps();
-	Image::Format format = p_image->get_format();
+	r_mask.resize(width * height);
+	PoolVector<uint8_t>::Write w = r_mask.write();
+	memset(w.ptr(), 0, width * height);
 
-	Ref<Image> fill_image = memnew(Image);
-	fill_image->create(width, height, mipmaps, format);
-	fill_image->lock();
-
-	Vector2 at;
-	Vector2 pos = p_at;
-	Color pixel;
-
-	Vector<Vector2> kernel;
-	switch (p_con) {
-		case FOUR_CONNECTED: {
-			kernel.push_back(Vector2(1, 0));
-			kernel.push_back(Vector2(0, -1));
-			kernel.push_back(Vector2(-1, 0));
-			kernel.push_back(Vector2(0, 1));
-		} break;
+	const int pixel_size = image_get_8bit_pixel_size(p_image->get_format());
+	if (pixel_size > 0) {
+		PoolVector<uint8_t> data = p_image->get_data();
+		PoolVector<uint8_t>::Read r = data.read();
 
-		case EIGHT_CONNECTED: {
-			kernel.push_back(Vector2(1, 0));
-			kernel.push_back(Vector2(1, -1));
-			kernel.push_back(Vector2(0, -1));
-			kernel.push_back(Vector2(-1, -1));
-			kernel.push_back(Vector2(-1, 0));
-			kernel.push_back(Vector2(-1, 1));
-			kernel.push_back(Vector2(0, 1));
-			kernel.push_back(Vector2(1, 1));
-		} break;
+		_FillMatchRaw match;
+		match.data = r.ptr();
+		match.pixel_size = pixel_size;
+		memcpy(match.seed, &r[(p_at.y * width + p_at.x) * pixel_size], pixel_size);
+		match.threshold = Math::floor(CLAMP(p_tolerance, 0.0, 1.0) * 255.0 + CMP_EPSILON);
+
+		_scanline_fill(width, height, p_at, diagonal, match, w.ptr());
+	} else {
+		p_image->lock();
+
+		_FillMatchColor match;
+		match.image = p_image.ptr();
+		match.width = width;
+		match.seed = p_image->get_pixel(p_at.x, p_at.y);
+		match.tolerance = MAX(0.0, p_tolerance);
+
+		_scanline_fill(width, height, p_at, diagonal, match, w.ptr());
+
+		p_image->unlock();
 	}
+}
 
-	BucketFillQueue to_fill;
-	// Reserve some memory for typical images such as textures, will grow as needed.
-	to_fill.array.reserve(MIN(512 * 512, width * height));
-	to_fill.push_back(pos);
+Ref<Image> GoostImage::bucket_fill(Ref<Image> p_image, const Point2 &p_at, const Color &p_fill_color, bool p_fill_image, Connectivity p_con, real_t p_tolerance) {
+	ERR_FAIL_COND_V(p_image.is_null(), Ref<Image>());
+	ERR_FAIL_COND_V(p_image->empty(), Ref<Image>());
+	ERR_FAIL_COND_V_MSG(p_image->is_compressed(), Ref<Image>(), "Cannot fill compressed image.");
 
-	while (!to_fill.is_empty()) {
-		pos = to_fill.pop_front();
+	if (!has_pixelv(p_image, p_at)) {
+		return Ref<Image>();
+	}
+	PoolVector<uint8_t> mask;
+	_bucket_fill_mask(p_image, Point2i(p_at.x, p_at.y), p_tolerance, p_con, mask);
 
-		for (int i = 0; i < kernel.size(); ++i) {
-			const Vector2 &dir = kernel[i];
-			at = pos + dir;
+	const int width = p_image->get_width();
+	const int height = p_image->get_height();
+	const bool mipmaps = p_image->has_mipmaps();
+	const Image::Format format = p_image->get_format();
+	const int pixel_size = Image::get_format_pixel_size(format);
 
-			if (has_pixelv(fill_image, at)) {
-				pixel = fill_image->get_pixelv(at);
-				if (pixel.a > 0.0) {
-					continue; // Already filled.
-				}
-			}
-			if (has_pixelv(fill_image, at)) {
-				pixel = p_image->get_pixelv(at);
-			} else {
-				continue;
-			}
-			if (pixel == filling_color) {
-				fill_image->set_pixelv(at, p_fill_color);
-				to_fill.push_back(at);
+	// Encode fill color once, then copy it to every filled pixel.
+	const PoolVector<uint8_t> color_data = image_encode_pixel(format, p_fill_color);
+	PoolVector<uint8_t>::Read color = color_data.read();
+
+	PoolVector<uint8_t>::Read m = mask.read();
+
+	PoolVector<uint8_t> fill_data;
+	fill_data.resize(Image::get_image_data_size(width, height, format, mipmaps));
+	{
+		PoolVector<uint8_t>::Write w = fill_data.write();
+		memset(w.ptr(), 0, fill_data.size());
+		for (int i = 0; i < width * height; ++i) {
+			if (m[i]) {
+				memcpy(&w[i * pixel_size], color.ptr(), pixel_size);
 			}
 		}
 	}
+	Ref<Image> fill_image = memnew(Image);
+	fill_image->create(width, height, mipmaps, format, fill_data);
+
 	if (p_fill_image) {
 		// Fill the actual image (no undo),
 		// else just return filled area as a new image.
-		Rect2 fill_rect(0, 0, width, height);
-		p_image->blend_rect(fill_image, fill_rect, Point2());
+		if (p_fill_color.a >= 1.0) {
+			// Blending opaque color is equivalent to replacing it.
+			PoolVector<uint8_t> data = p_image->get_data();
+			{
+				PoolVector<uint8_t>::Write w = data.write();
+				for (int i = 0; i < width * height; ++i) {
+					if (m[i]) {
+						memcpy(&w[i * pixel_size], color.ptr(), pixel_size);
+					}
+				}
+			}
+			p_image->create(width, height, mipmaps, format, data);
+		} else {
+			Rect2 fill_rect(0, 0, width, height);
+			p_image->blend_rect(fill_image, fill_rect, Point2());
+		}
 	}
+	return fill_image;
+}
 
-	fill_image->unlock();
-	p_image->unlock();
+Ref<Image> GoostImage::bucket_fill_mask(const Ref<Image> &p_image, const Point2 &p_at, Connectivity p_con, real_t p_tolerance) {
+	ERR_FAIL_COND_V(p_image.is_null(), Ref<Image>());
+	ERR_FAIL_COND_V(p_image->empty(), Ref<Image>());
+	ERR_FAIL_COND_V_MSG(p_image->is_compressed(), Ref<Image>(), "Cannot fill compressed image.");
 
-	return fill_image;
+	if (!has_pixelv(p_image, p_at)) {
+		return Ref<Image>();
+	}
+	PoolVector<uint8_t> mask;
+	_bucket_fill_mask(p_image, Point2i(p_at.x, p_at.y), p_tolerance, p_con, mask);
+
+	Ref<Image> mask_image = memnew(Image);
+	mask_image->create(p_image->get_width(), p_image->get_height(), false, Image::FORMAT_L8, mask);
+	return mask_image;
 }
 
 void GoostImage::resize_hqx(Ref<Image> p_image, int p_scale) {
@@ -184,21 +527,234 @@ PIX *pix_create_from_image(Ref<Image> p_image);
 Ref<Image> image_create_from_pix(PIX *p_pix, bool p_include_alpha = true);
 void image_copy_from_pix(Ref<Image> p_image, PIX *p_pix, bool p_include_alpha = true);
 
+// Operations on PIX shared with `ImagePix`, each returns a new PIX.
+
+PIX *pix_rotate(PIX *p_pix, real_t p_angle, bool p_expand) {
+	const int w = p_expand ? pixGetWidth(p_pix) : 0;
+	const int h = p_expand ? pixGetHeight(p_pix) : 0;
+	return pixRotate(p_pix, p_angle, L_ROTATE_SHEAR, L_BRING_IN_BLACK, w, h);
+}
+
+PIX *pix_binarize(PIX *p_pix, real_t p_threshold, bool p_invert) {
+	PIX *pix_bin = nullptr;
+	if (p_threshold < 0) {
+		pix_bin = pixConvertTo1Adaptive(p_pix);
+	} else {
+		pix_bin = pixConvertTo1(p_pix, uint8_t(CLAMP(p_threshold * 255.0, 0, 255)));
+	}
+	const l_uint32 val0 = p_invert ? 0 : 0xffffffff;
+	const l_uint32 val1 = p_invert ? 0xffffffff : 0;
+
+	PIX *pix_grayscale = pixConvert1To8(nullptr, pix_bin, val0, val1);
+	pixDestroy(&pix_bin);
+
+	return pix_grayscale;
+}
+
+// The alpha channel is not preserved, the result is opaque.
+PIX *pix_morph(PIX *p_pix, GoostImage::MorphOperation p_op, const Size2i &p_kernel_size) {
+	const int hs = p_kernel_size.x;
+	const int vs = p_kernel_size.y;
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_V_MSG(hs % 2 == 0, nullptr, "Kernel X size must be an odd number.");
+	ERR_FAIL_COND_V_MSG(vs % 2 == 0, nullptr, "Kernel Y size must be an odd number.");
+	ERR_FAIL_COND_V_MSG(hs <= 1 || vs <= 1, nullptr, "Kernel size must be greater than 1.");
+#endif
+	l_int32 type = -1;
+	PIX *(*gray_morph)(PIX *, l_int32, l_int32) = nullptr;
+	PIX *(*binary_morph)(PIX *, PIX *, l_int32, l_int32) = nullptr;
+	switch (p_op) {
+		case GoostImage::MORPH_DILATE: {
+			type = L_MORPH_DILATE;
+			gray_morph = pixDilateGray;
+			binary_morph = pixDilateBrick;
+		} break;
+		case GoostImage::MORPH_ERODE: {
+			type = L_MORPH_ERODE;
+			gray_morph = pixErodeGray;
+			binary_morph = pixErodeBrick;
+		} break;
+		case GoostImage::MORPH_OPEN: {
+			type = L_MORPH_OPEN;
+			gray_morph = pixOpenGray;
+			binary_morph = pixOpenBrick;
+		} break;
+		case GoostImage::MORPH_CLOSE: {
+			type = L_MORPH_CLOSE;
+			gray_morph = pixCloseGray;
+			binary_morph = pixCloseBrick;
+		} break;
+		default: {
+			ERR_FAIL_V_MSG(nullptr, "Invalid morph type");
+		}
+	}
+	// Grayscale and binary images keep their depth, as those are morphed
+	// faster than color images, which are morphed per component.
+	PIX *pix_out = nullptr;
+	const l_int32 depth = pixGetDepth(p_pix);
+	if (depth == 1) {
+		pix_out = binary_morph(nullptr, p_pix, hs, vs);
+	} else if (depth == 8) {
+		pix_out = gray_morph(p_pix, hs, vs);
+	} else if (depth == 32) {
+		pix_out = pixColorMorph(p_pix, type, hs, vs);
+	} else {
+		PIX *pix_rgb = pixConvertTo32(p_pix);
+		pix_out = pixColorMorph(pix_rgb, type, hs, vs);
+		pixDestroy(&pix_rgb);
+	}
+	if (pix_out && pixGetDepth(pix_out) == 32) {
+		pixSetComponentArbitrary(pix_out, L_ALPHA_CHANNEL, 255);
+	}
+	return pix_out;
+}
+
+Point2 pix_get_centroid(PIX *p_pix) {
+	PIX *pix_bin = pixConvertTo8(p_pix, 0);
+
+	l_float32 x, y;
+	pixCentroid(pix_bin, nullptr, nullptr, &x, &y);
+	pixDestroy(&pix_bin);
+
+	return Point2(static_cast<real_t>(x), static_cast<real_t>(y));
+}
+
+// Sums pixel values in rows of a `PIX`, like `pixAverageInRect()` and
+// `pixAverageInRectRGB()` do. Sums of integers are exact, so the result does
+// not depend on how rows are split between threads.
+struct _PixSum {
+	const l_uint32 *data = nullptr;
+	int wpl = 0;
+	int depth = 0;
+	const l_uint32 *mask_data = nullptr;
+	int mask_wpl = 0;
+	int x_start = 0;
+	int x_end = 0;
+	int y_start = 0;
+
+	LocalVector<l_float64> sums; // Three components per band.
+	LocalVector<int> counts; // Per band.
+
+	void process_rows(int p_band, int p_from, int p_to) {
+		l_float64 r = 0.0;
+		l_float64 g = 0.0;
+		l_float64 b = 0.0;
+		int count = 0;
+
+		for (int i = y_start + p_from; i < y_start + p_to; ++i) {
+			const l_uint32 *line = data + i * wpl;
+			const l_uint32 *line_mask = mask_data ? mask_data + i * mask_wpl : nullptr;
+			for (int j = x_start; j < x_end; ++j) {
+				if (line_mask && GET_DATA_BIT(line_mask, j) == 1) {
+					continue;
+				}
+				if (depth == 8) {
+					r += GET_DATA_BYTE(line, j);
+				} else {
+					const l_uint32 pixel = line[j];
+					r += (pixel >> L_RED_SHIFT) & 0xff;
+					g += (pixel >> L_GREEN_SHIFT) & 0xff;
+					b += (pixel >> L_BLUE_SHIFT) & 0xff;
+				}
+				count++;
+			}
+		}
+		sums[p_band * 3 + 0] = r;
+		sums[p_band * 3 + 1] = g;
+		sums[p_band * 3 + 2] = b;
+		counts[p_band] = count;
+	}
+};
+
+// The mask can be of any depth, and is converted to 1 bpp.
+Color pix_get_pixel_average(PIX *p_pix, const Rect2 &p_rect, PIX *p_mask) {
+	const int depth = pixGetDepth(p_pix);
+	ERR_FAIL_COND_V_MSG(depth != 8 && depth != 32, Color(), "Invalid input data.");
+
+	PIX *pix_mask = nullptr;
+	if (p_mask) {
+		pix_mask = pixConvertTo1(p_mask, 0);
+	}
+	int w = pixGetWidth(p_pix);
+	int h = pixGetHeight(p_pix);
+	if (pix_mask) {
+		// Alignment is at the top-left corner.
+		w = MIN(w, (int)pixGetWidth(pix_mask));
+		h = MIN(h, (int)pixGetHeight(pix_mask));
+	}
+	BOX *box = nullptr;
+	if (!p_rect.has_no_area()) {
+		box = memnew(Box);
+		box->x = p_rect.position.x;
+		box->y = p_rect.position.y;
+		box->w = p_rect.size.x;
+		box->h = p_rect.size.y;
+	}
+	_PixSum sum;
+	l_int32 y_end = 0;
+	const l_ok ret = boxClipToRectangleParams(box, w, h, &sum.x_start, &sum.y_start, &sum.x_end, &y_end, nullptr, nullptr);
+	if (box) {
+		memdelete(box);
+	}
+	if (ret == 1) {
+		if (pix_mask) {
+			pixDestroy(&pix_mask);
+		}
+		ERR_FAIL_V_MSG(Color(), "Invalid input data.");
+	}
+	sum.data = pixGetData(p_pix);
+	sum.wpl = pixGetWpl(p_pix);
+	sum.depth = depth;
+	if (pix_mask) {
+		sum.mask_data = pixGetData(pix_mask);
+		sum.mask_wpl = pixGetWpl(pix_mask);
+	}
+	const int rows = y_end - sum.y_start;
+	const int thread_count = image_get_thread_count(sum.x_end - sum.x_start, rows);
+	sum.sums.resize(thread_count * 3);
+	sum.counts.resize(thread_count);
+
+	image_process_rows(&sum, rows, thread_count);
+
+	if (pix_mask) {
+		pixDestroy(&pix_mask);
+	}
+	l_float64 total[3] = { 0.0, 0.0, 0.0 };
+	int count = 0;
+	for (uint32_t i = 0; i < sum.counts.size(); ++i) {
+		total[0] += sum.sums[i * 3 + 0];
+		total[1] += sum.sums[i * 3 + 1];
+		total[2] += sum.sums[i * 3 + 2];
+		count += sum.counts[i];
+	}
+	// If this happens, it's an internal bug (should be handled above).
+	ERR_FAIL_COND_V_MSG(count == 0, Color(), "All pixels are filtered out.");
+
+	Color average;
+	if (depth == 8) {
+		const l_float32 c = total[0] / (l_float32)count;
+		average = Color(c, c, c) / 255;
+	} else {
+		l_uint32 pixel_rgb = 0;
+		composeRGBPixel(l_uint32(total[0] / (l_float64)count), l_uint32(total[1] / (l_float64)count),
+				l_uint32(total[2] / (l_float64)count), &pixel_rgb);
+		average = Color::hex(pixel_rgb);
+	}
+	average.a = 1.0f;
+
+	return average;
+}
+
 void GoostImage::rotate(Ref<Image> p_image, real_t p_angle, bool p_expand) {
 	ERR_FAIL_COND(p_image.is_null());
 	ERR_FAIL_COND(p_image->empty());
 
 	PIX *pix_in = pix_create_from_image(p_image);
 
-	const int w = p_expand ? p_image->get_width() : 0;
-	const int h = p_expand ? p_image->get_height() : 0;
-	const int type = L_ROTATE_SHEAR;
-	const bool hq = type == L_ROTATE_AREA_MAP;
-
-	PIX *pix_out = pixRotate(pix_in, p_angle, type, L_BRING_IN_BLACK, w, h);
+	PIX *pix_out = pix_rotate(pix_in, p_angle, p_expand);
 	pixDestroy(&pix_in);
 
-	image_copy_from_pix(p_image, pix_out, hq ? false : true);
+	image_copy_from_pix(p_image, pix_out);
 	pixDestroy(&pix_out);
 }
 
@@ -228,26 +784,62 @@ void GoostImage::rotate_180(Ref<Image> p_image) {
 	pixDestroy(&pix_out);
 }
 
+// Binarizes rows of an image with a fixed threshold, see `GoostImage::binarize()`.
+struct _Binarize {
+	const uint8_t *src = nullptr;
+	uint8_t *dst = nullptr;
+	int width = 0;
+	int pixel_size = 0;
+	uint8_t threshold = 0;
+	uint8_t below = 0;
+	uint8_t above = 0;
+
+	void process_rows(int p_band, int p_from, int p_to) {
+		for (int i = p_from * width; i < p_to * width; ++i) {
+			const uint8_t *p = &src[i * pixel_size];
+			const uint8_t gray = pixel_size >= 3 ? image_get_luminance(p) : p[0];
+			dst[i] = gray < threshold ? below : above;
+		}
+	}
+};
+
 void GoostImage::binarize(Ref<Image> p_image, real_t p_threshold, bool p_invert) {
 	ERR_FAIL_COND(p_image.is_null());
 	ERR_FAIL_COND(p_image->empty());
 
+	const Image::Format format = p_image->get_format();
+	if (p_threshold >= 0 && (format == Image::FORMAT_L8 || format == Image::FORMAT_R8 ||
+									format == Image::FORMAT_RGB8 || format == Image::FORMAT_RGBA8)) {
+		// Same result as with Leptonica, but rows are processed in parallel.
+		const int width = p_image->get_width();
+		const int height = p_image->get_height();
+
+		PoolVector<uint8_t> dst;
+		dst.resize(Image::get_image_data_size(width, height, Image::FORMAT_L8));
+		{
+			const PoolVector<uint8_t> src = p_image->get_data();
+			PoolVector<uint8_t>::Read r = src.read();
+			PoolVector<uint8_t>::Write w = dst.write();
+
+			_Binarize job;
+			job.src = r.ptr();
+			job.dst = w.ptr();
+			job.width = width;
+			job.pixel_size = image_get_8bit_pixel_size(format);
+			job.threshold = uint8_t(CLAMP(p_threshold * 255.0, 0, 255));
+			job.below = p_invert ? 255 : 0;
+			job.above = p_invert ? 0 : 255;
+
+			image_process_rows(&job, height, image_get_thread_count(width, height));
+		}
+		p_image->create(width, height, false, Image::FORMAT_L8, dst);
+		return;
+	}
 	PIX *pix_in = pix_create_from_image(p_image);
 
-	PIX *pix_bin = nullptr;
-	if (p_threshold < 0) {
-		pix_bin = pixConvertTo1Adaptive(pix_in);
-	} else {
-		pix_bin = pixConvertTo1(pix_in, uint8_t(CLAMP(p_threshold * 255.0, 0, 255)));
-	}
+	PIX *pix_grayscale = pix_binarize(pix_in, p_threshold, p_invert);
 	pixDestroy(&pix_in);
 
-	const l_uint32 val0 = p_invert ? 0 : 0xffffffff;
-	const l_uint32 val1 = p_invert ? 0xffffffff : 0;
-
-	PIX *pix_grayscale = pixConvert1To8(nullptr, pix_bin, val0, val1);
-	pixDestroy(&pix_bin);
-
 	image_copy_from_pix(p_image, pix_grayscale);
 	pixDestroy(&pix_grayscale);
 }
@@ -268,39 +860,17 @@ void GoostImage::morph(Ref<Image> p_image, MorphOperation p_op, Size2i p_kernel_
 	ERR_FAIL_COND(p_image.is_null());
 	ERR_FAIL_COND(p_image->empty());
 
-	const int hs = p_kernel_size.x;
-	const int vs = p_kernel_size.y;
-#ifdef DEBUG_ENABLED
-	ERR_FAIL_COND_MSG(hs % 2 == 0, "Kernel X size must be an odd number.");
-	ERR_FAIL_COND_MSG(vs % 2 == 0, "Kernel Y size must be an odd number.");
-	ERR_FAIL_COND_MSG(hs <= 1 || vs <= 1, "Kernel size must be greater than 1.");
-#endif
 	p_image->convert(Image::FORMAT_RGBA8);
 
 	PIX *pix_in = pix_create_from_image(p_image);
-	l_int32 type = -1;
-	switch (p_op) {
-		case MORPH_DILATE: {
-			type = L_MORPH_DILATE;
-		} break;
-		case MORPH_ERODE: {
-			type = L_MORPH_ERODE;
-		} break;
-		case MORPH_OPEN: {
-			type = L_MORPH_OPEN;
-		} break;
-		case MORPH_CLOSE: {
-			type = L_MORPH_CLOSE;
-		} break;
-		default: {
-			ERR_FAIL_MSG("Invalid morph type");
-		}
-	}
-	PIX *pix_morph = pixColorMorph(pix_in, type, hs, vs);
-	pixDestroy(&pix_in);
 
-	image_copy_from_pix(p_image, pix_morph, false);
-	pixDestroy(&pix_morph);
+	PIX *pix_out = pix_morph(pix_in, p_op, p_kernel_size);
+	pixDestroy(&pix_in);
+	if (!pix_out) {
+		return;
+	}
+	image_copy_from_pix(p_image, pix_out, false);
+	pixDestroy(&pix_out);
 }
 
 Ref<Image> GoostImage::tile(const Ref<Image> &p_image, const Size2i &p_size, WrapMode p_mode) {
@@ -407,70 +977,31 @@ Point2 GoostImage::get_centroid(const Ref<Image> &p_image) {
 
 	PIX *pix_in = pix_create_from_image(p_image);
 
-	PIX *pix_bin = pixConvertTo8(pix_in, 0);
+	const Point2 centroid = pix_get_centroid(pix_in);
 	pixDestroy(&pix_in);
 
-	l_float32 x, y;
-	pixCentroid(pix_bin, nullptr, nullptr, &x, &y);
-	pixDestroy(&pix_bin);
-
-	return Point2(static_cast<real_t>(x), static_cast<real_t>(y));
+	return centroid;
 }
 
 Color GoostImage::get_pixel_average(const Ref<Image> &p_image, const Rect2 &p_rect, const Ref<Image> &p_mask) {
 	ERR_FAIL_COND_V(p_image.is_null(), Color());
 	ERR_FAIL_COND_V(p_image->empty(), Color());
 
-	bool using_rect = !p_rect.has_no_area();
-
 	bool using_mask = p_mask.is_valid();
 	if (using_mask) {
 		ERR_FAIL_COND_V(p_mask->empty(), Color());
 		ERR_FAIL_COND_V(p_mask->is_invisible(), Color());
 	}
 	PIX *pix = pix_create_from_image(p_image);
+	PIX *pix_mask = using_mask ? pix_create_from_image(p_mask) : nullptr;
+
+	const Color average = pix_get_pixel_average(pix, p_rect, pix_mask);
 
-	PIX *pix_mask = nullptr;
-	if (using_mask) {
-		PIX *pix_tmp = pix_create_from_image(p_mask);
-		pix_mask = pixConvertTo1(pix_tmp, 0);
-		pixDestroy(&pix_tmp);
-	}
-	BOX *box = nullptr;
-	if (using_rect) {
-		box = memnew(Box);
-		box->x = p_rect.position.x;
-		box->y = p_rect.position.y;
-		box->w = p_rect.size.x;
-		box->h = p_rect.size.y;
-	}
-	l_uint32 pixel_rgb = 0;
-	Color average;
-	l_ok ret = 0;
-
-	if (pix->d == 8) {
-		l_float32 c = 0;
-		l_int32 max = 255;
-		ret = pixAverageInRect(pix, pix_mask, box, 0, max, 1, &c);
-		average = Color(c, c, c) / max;
-		average.a = 1.0f;
-	} else if (pix->d == 32) {
-		ret = pixAverageInRectRGB(pix, pix_mask, box, 1, &pixel_rgb);
-		average = Color::hex(pixel_rgb);
-		average.a = 1.0f;
-	}
 	if (pix_mask) {
 		pixDestroy(&pix_mask);
 	}
-	if (box) {
-		memdelete(box);
-	}
 	pixDestroy(&pix);
 
-	ERR_FAIL_COND_V_MSG(ret == 1, Color(), "Invalid input data.");
-	// If this happens, it's an internal bug (should be handled above).
-	ERR_FAIL_COND_V_MSG(ret == 2, Color(), "All pixels are filtered out.");
-
 	return average;
 }
 
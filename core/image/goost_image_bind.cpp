@@ -5,12 +5,30 @@
 
 _GoostImage *_GoostImage::singleton = nullptr;
 
-void _GoostImage::replace_color(Ref<Image> p_image, const Color &p_color, const Color &p_with_color) {
-	GoostImage::replace_color(p_image, p_color, p_with_color);
+void _GoostImage::replace_color(Ref<Image> p_image, const Color &p_color, const Color &p_with_color, real_t p_tolerance) {
+	GoostImage::replace_color(p_image, p_color, p_with_color, p_tolerance);
 }
 
-Ref<Image> _GoostImage::bucket_fill(Ref<Image> p_image, const Point2 &p_at, const Color &p_fill_color, bool p_fill_image, Connectivity p_con) {
-	return GoostImage::bucket_fill(p_image, p_at, p_fill_color, p_fill_image, GoostImage::Connectivity(p_con));
+void _GoostImage::replace_colors(Ref<Image> p_image, const PoolColorArray &p_colors, const PoolColorArray &p_with_colors, real_t p_tolerance) {
+	Vector<Color> colors;
+	colors.resize(p_colors.size());
+	for (int i = 0; i < p_colors.size(); ++i) {
+		colors.write[i] = p_colors[i];
+	}
+	Vector<Color> with_colors;
+	with_colors.resize(p_with_colors.size());
+	for (int i = 0; i < p_with_colors.size(); ++i) {
+		with_colors.write[i] = p_with_colors[i];
+	}
+	GoostImage::replace_colors(p_image, colors, with_colors, p_tolerance);
+}
+
+Ref<Image> _GoostImage::bucket_fill(Ref<Image> p_image, const Point2 &p_at, const Color &p_fill_color, bool p_fill_image, Connectivity p_con, real_t p_tolerance) {
+	return GoostImage::bucket_fill(p_image, p_at, p_fill_color, p_fill_image, GoostImage::Connectivity(p_con), p_tolerance);
+}
+
+Ref<Image> _GoostImage::bucket_fill_mask(const Ref<Image> &p_image, const Point2 &p_at, Connectivity p_con, real_t p_tolerance) {
+	return GoostImage::bucket_fill_mask(p_image, p_at, GoostImage::Connectivity(p_con), p_tolerance);
 }
 
 void _GoostImage::resize_hqx(Ref<Image> p_image, int p_scale) {
@@ -91,8 +109,10 @@ Color _GoostImage::get_pixel_average(const Ref<Image> &p_image, const Rect2 &p_r
 }
 
 void _GoostImage::_bind_methods() {
-	ClassDB::bind_method(D_METHOD("replace_color", "image", "color", "with_color"), &_GoostImage::replace_color);
-	ClassDB::bind_method(D_METHOD("bucket_fill", "image", "at", "fill_color", "fill_image", "connectivity"), &_GoostImage::bucket_fill, DEFVAL(true), DEFVAL(FOUR_CONNECTED));
+	ClassDB::bind_method(D_METHOD("replace_color", "image", "color", "with_color", "tolerance"), &_GoostImage::replace_color, DEFVAL(0.0));
+	ClassDB::bind_method(D_METHOD("replace_colors", "image", "colors", "with_colors", "tolerance"), &_GoostImage::replace_colors, DEFVAL(0.0));
+	ClassDB::bind_method(D_METHOD("bucket_fill", "image", "at", "fill_color", "fill_image", "connectivity", "tolerance"), &_GoostImage::bucket_fill, DEFVAL(true), DEFVAL(FOUR_CONNECTED), DEFVAL(0.0));
+	ClassDB::bind_method(D_METHOD("bucket_fill_mask", "image", "at", "connectivity", "tolerance"), &_GoostImage::bucket_fill_mask, DEFVAL(FOUR_CONNECTED), DEFVAL(0.0));
 	ClassDB::bind_method(D_METHOD("resize_hqx", "image", "scale"), &_GoostImage::resize_hqx, DEFVAL(2));
 
 	ClassDB::bind_method(D_METHOD("rotate", "image", "angle", "expand"), &_GoostImage::rotate, DEFVAL(true));
@@ -37,8 +37,10 @@ public:
 	};
 
 public:
-	void replace_color(Ref<Image> p_image, const Color &p_color, const Color &p_with_color);
-	Ref<Image> bucket_fill(Ref<Image> p_image, const Point2 &p_at, const Color &p_fill_color, bool p_fill_image = true, Connectivity p_con = FOUR_CONNECTED);
+	void replace_color(Ref<Image> p_image, const Color &p_color, const Color &p_with_color, real_t p_tolerance = 0.0);
+	void replace_colors(Ref<Image> p_image, const PoolColorArray &p_colors, const PoolColorArray &p_with_colors, real_t p_tolerance = 0.0);
+	Ref<Image> bucket_fill(Ref<Image> p_image, const Point2 &p_at, const Color &p_fill_color, bool p_fill_image = true, Connectivity p_con = FOUR_CONNECTED, real_t p_tolerance = 0.0);
+	Ref<Image> bucket_fill_mask(const Ref<Image> &p_image, const Point2 &p_at, Connectivity p_con = FOUR_CONNECTED, real_t p_tolerance = 0.0);
 	void resize_hqx(Ref<Image> p_image, int p_scale);
 
 	void rotate(Ref<Image> p_image, real_t p_angle, bool p_expand);
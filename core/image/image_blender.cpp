@@ -1,5 +1,7 @@
 #include "image_blender.h"
 
+#include "image_utils.h"
+
 Color ImageBlender::calculate_factor(const Color &p_src, const Color &p_dst, BlendFactor p_factor) const {
 	Color color_factor;
 
@@ -85,7 +87,37 @@ Color ImageBlender::blend_colors(const Color &p_src, const Color &p_dst) const {
 	return color;
 }
 
+struct ImageBlender::BlendRows {
+	const ImageBlender *blender = nullptr;
+	Image *src = nullptr;
+	Image *dst = nullptr;
+	Point2i src_pos;
+	Point2i dst_pos;
+	int width = 0;
+
+	void process_rows(int p_band, int p_from, int p_to) {
+		for (int i = p_from; i < p_to; i++) {
+			for (int j = 0; j < width; j++) {
+				int src_x = src_pos.x + j;
+				int src_y = src_pos.y + i;
+
+				int dst_x = dst_pos.x + j;
+				int dst_y = dst_pos.y + i;
+
+				Color sc = src->get_pixel(src_x, src_y);
+				Color dc = dst->get_pixel(dst_x, dst_y);
+
+				dst->set_pixel(dst_x, dst_y, blender->blend_colors(sc, dc));
+			}
+		}
+	}
+};
+
 void ImageBlender::blend_rect(const Ref<Image> p_src, const Rect2 &p_src_rect, Ref<Image> p_dst, const Point2 &p_dst_pos) const {
+	_blend_rect(p_src, p_src_rect, p_dst, p_dst_pos, nullptr);
+}
+
+void ImageBlender::_blend_rect(const Ref<Image> p_src, const Rect2 &p_src_rect, Ref<Image> p_dst, const Point2 &p_dst_pos, ThreadWorkPool *p_pool) const {
 	ERR_FAIL_COND_MSG(p_dst.is_null(), "It's not a reference to a valid Image object.");
 	ERR_FAIL_COND_MSG(p_src.is_null(), "It's not a reference to a valid Image object.");
 	int dsize = p_dst->get_data().size();
@@ -111,20 +143,18 @@ void ImageBlender::blend_rect(const Ref<Image> p_src, const Rect2 &p_src_rect, R
 	Ref<Image> img = p_src;
 	img->lock();
 
-	for (int i = 0; i < dest_rect.size.y; i++) {
-		for (int j = 0; j < dest_rect.size.x; j++) {
-			int src_x = clipped_src_rect.position.x + j;
-			int src_y = clipped_src_rect.position.y + i;
+	BlendRows job;
+	job.blender = this;
+	job.src = img.ptr();
+	job.dst = p_dst.ptr();
+	job.src_pos = clipped_src_rect.position;
+	job.dst_pos = dest_rect.position;
+	job.width = dest_rect.size.x;
 
-			int dst_x = dest_rect.position.x + j;
-			int dst_y = dest_rect.position.y + i;
+	// Rows may overlap when blending an image onto itself.
+	const int thread_count = img == p_dst ? 1 : image_get_thread_count(dest_rect.size.x, dest_rect.size.y);
+	image_process_rows(&job, dest_rect.size.y, thread_count, p_pool);
 
-			Color sc = img->get_pixel(src_x, src_y);
-			Color dc = p_dst->get_pixel(dst_x, dst_y);
-
-			p_dst->set_pixel(dst_x, dst_y, blend_colors(sc, dc));
-		}
-	}
 	img->unlock();
 	p_dst->unlock();
 }
@@ -161,14 +191,26 @@ void ImageBlender::stamp_rect(const Ref<Image> p_src, const Rect2 &p_src_rect, R
 	float offset_x = 0.0;
 	float offset_y = 0.0;
 
+	// Start threads once for all stamps rather than for each of them.
+	ThreadWorkPool pool;
+	ThreadWorkPool *pool_ptr = nullptr;
+	const int thread_count = image_get_thread_count(p_src_rect.size.x, p_src_rect.size.y);
+	if (p_src != p_dst && thread_count > 1) {
+		pool.init(thread_count);
+		pool_ptr = &pool;
+	}
 	do {
-		blend_rect(p_src, p_src_rect, p_dst, Point2(start_point.x + offset_x, start_point.y + offset_y));
+		_blend_rect(p_src, p_src_rect, p_dst, Point2(start_point.x + offset_x, start_point.y + offset_y), pool_ptr);
 
 		offset_x += step_x * p_spacing;
 		offset_y += step_y * p_spacing;
 
 		distance -= p_spacing;
 	} while (distance >= p_spacing);
+
+	if (pool_ptr) {
+		pool.finish();
+	}
 }
 
 void ImageBlender::_bind_methods() {
@@ -3,6 +3,8 @@
 #include "core/image.h"
 #include "core/method_bind_ext.gen.inc"
 
+class ThreadWorkPool;
+
 class ImageBlender : public Reference {
 	GDCLASS(ImageBlender, Reference);
 
@@ -50,6 +52,9 @@ private:
 
 	Color blend_colors(const Color &p_src, const Color &p_dst) const;
 
+	struct BlendRows;
+	void _blend_rect(const Ref<Image> p_src, const Rect2 &p_src_rect, Ref<Image> p_dst, const Point2 &p_dst_pos, ThreadWorkPool *p_pool) const;
+
 public:
 	void blend_rect(const Ref<Image> p_src, const Rect2 &p_src_rect, Ref<Image> p_dst, const Point2 &p_dst_pos) const;
 	void stamp_rect(const Ref<Image> p_src, const Rect2 &p_src_rect, Ref<Image> p_dst, const Point2 &p_dst_init_pos, const Point2 &p_dst_end_pos, float p_spacing) const;
@@ -0,0 +1,426 @@
+#include "image_pipeline.h"
+
+#include "image_pix.h"
+#include "image_utils.h"
+
+#include "core/local_vector.h"
+
+// A per-pixel step operating on raw bytes of an 8-bit image.
+struct _FusedOp {
+	bool binarize = false;
+	int pixel_size = 0; // Input pixel size.
+
+	// Binarization.
+	bool luminance = false;
+	uint8_t threshold = 0;
+	uint8_t below = 0;
+	uint8_t above = 0;
+
+	// Color replacement.
+	PixelRange range;
+	uint8_t with[4] = {};
+};
+
+// Applies fused steps to rows of an image. Data is processed in place unless
+// binarization changes pixel size, in which case `src` and `dst` differ.
+struct _FusedPass {
+	const _FusedOp *ops = nullptr;
+	int op_count = 0;
+	const uint8_t *src = nullptr;
+	uint8_t *dst = nullptr;
+	int src_size = 0;
+	int dst_size = 0;
+	int width = 0;
+
+	void process_rows(int p_band, int p_from, int p_to) {
+		for (int i = p_from * width; i < p_to * width; ++i) {
+			uint8_t px[4];
+			memcpy(px, &src[i * src_size], src_size);
+
+			for (int j = 0; j < op_count; ++j) {
+				const _FusedOp &op = ops[j];
+				if (op.binarize) {
+					const uint8_t gray = op.luminance ? image_get_luminance(px) : px[0];
+					px[0] = gray < op.threshold ? op.below : op.above;
+				} else if (op.range.has(px, op.pixel_size)) {
+					memcpy(px, op.with, op.pixel_size);
+				}
+			}
+			memcpy(&dst[i * dst_size], px, dst_size);
+		}
+	}
+};
+
+void ImagePipeline::_add_step(const Step &p_step) {
+	steps.push_back(p_step);
+	emit_changed();
+}
+
+void ImagePipeline::add_replace_color(const Color &p_color, const Color &p_with_color, real_t p_tolerance) {
+	Step step;
+	step.type = STEP_REPLACE_COLOR;
+	step.color = p_color;
+	step.with_color = p_with_color;
+	step.tolerance = p_tolerance;
+	_add_step(step);
+}
+
+void ImagePipeline::add_binarize(real_t p_threshold, bool p_invert) {
+	Step step;
+	step.type = STEP_BINARIZE;
+	step.threshold = p_threshold;
+	step.invert = p_invert;
+	_add_step(step);
+}
+
+void ImagePipeline::add_morph(_GoostImage::MorphOperation p_op, const Vector2 &p_kernel_size) {
+	Step step;
+	step.type = STEP_MORPH;
+	step.operation = GoostImage::MorphOperation(p_op);
+	step.kernel_size = p_kernel_size;
+	_add_step(step);
+}
+
+void ImagePipeline::add_rotate(real_t p_angle, bool p_expand) {
+	Step step;
+	step.type = STEP_ROTATE;
+	step.angle = p_angle;
+	step.expand = p_expand;
+	_add_step(step);
+}
+
+void ImagePipeline::add_tile(const Vector2 &p_size, _GoostImage::WrapMode p_mode) {
+	ERR_FAIL_COND_MSG(p_size.x < 1 || p_size.y < 1, "Tile size must be positive.");
+	Step step;
+	step.type = STEP_TILE;
+	step.size = p_size;
+	step.wrap_mode = GoostImage::WrapMode(p_mode);
+	_add_step(step);
+}
+
+void ImagePipeline::add_blend(const Ref<Image> &p_image, const Vector2 &p_position) {
+	ERR_FAIL_COND(p_image.is_null());
+	ERR_FAIL_COND(p_image->empty());
+	Step step;
+	step.type = STEP_BLEND;
+	step.image = p_image;
+	step.position = p_position;
+	_add_step(step);
+}
+
+ImagePipeline::StepType ImagePipeline::get_step_type(int p_index) const {
+	ERR_FAIL_INDEX_V(p_index, steps.size(), STEP_MAX);
+	return steps[p_index].type;
+}
+
+void ImagePipeline::remove_step(int p_index) {
+	ERR_FAIL_INDEX(p_index, steps.size());
+	steps.remove(p_index);
+	emit_changed();
+}
+
+void ImagePipeline::clear_steps() {
+	steps.clear();
+	emit_changed();
+}
+
+void ImagePipeline::set_steps(const Array &p_steps) {
+	steps.clear();
+
+	for (int i = 0; i < p_steps.size(); ++i) {
+		ERR_CONTINUE_MSG(p_steps[i].get_type() != Variant::DICTIONARY, "Each step must be a Dictionary.");
+		const Dictionary d = p_steps[i];
+		const int type = d.get("type", -1);
+		ERR_CONTINUE_MSG(type < 0 || type >= STEP_MAX, "Invalid step type.");
+
+		Step s;
+		s.type = StepType(type);
+		switch (s.type) {
+			case STEP_REPLACE_COLOR: {
+				s.color = d.get("color", s.color);
+				s.with_color = d.get("with_color", s.with_color);
+				s.tolerance = d.get("tolerance", s.tolerance);
+			} break;
+			case STEP_BINARIZE: {
+				s.threshold = d.get("threshold", s.threshold);
+				s.invert = d.get("invert", s.invert);
+			} break;
+			case STEP_MORPH: {
+				s.operation = GoostImage::MorphOperation(int(d.get("operation", s.operation)));
+				s.kernel_size = Vector2(d.get("kernel_size", Vector2(s.kernel_size)));
+			} break;
+			case STEP_ROTATE: {
+				s.angle = d.get("angle", s.angle);
+				s.expand = d.get("expand", s.expand);
+			} break;
+			case STEP_TILE: {
+				s.size = Vector2(d.get("size", Vector2(s.size)));
+				s.wrap_mode = GoostImage::WrapMode(int(d.get("wrap_mode", s.wrap_mode)));
+			} break;
+			case STEP_BLEND: {
+				s.image = Ref<Image>(d.get("image", Variant()));
+				s.position = Vector2(d.get("position", Vector2(s.position)));
+			} break;
+			default: {
+			}
+		}
+		steps.push_back(s);
+	}
+	emit_changed();
+}
+
+Array ImagePipeline::get_steps() const {
+	Array ret;
+	for (int i = 0; i < steps.size(); ++i) {
+		const Step &s = steps[i];
+		Dictionary d;
+		d["type"] = s.type;
+		switch (s.type) {
+			case STEP_REPLACE_COLOR: {
+				d["color"] = s.color;
+				d["with_color"] = s.with_color;
+				d["tolerance"] = s.tolerance;
+			} break;
+			case STEP_BINARIZE: {
+				d["threshold"] = s.threshold;
+				d["invert"] = s.invert;
+			} break;
+			case STEP_MORPH: {
+				d["operation"] = s.operation;
+				d["kernel_size"] = Vector2(s.kernel_size);
+			} break;
+			case STEP_ROTATE: {
+				d["angle"] = s.angle;
+				d["expand"] = s.expand;
+			} break;
+			case STEP_TILE: {
+				d["size"] = Vector2(s.size);
+				d["wrap_mode"] = s.wrap_mode;
+			} break;
+			case STEP_BLEND: {
+				d["image"] = s.image;
+				d["position"] = Vector2(s.position);
+			} break;
+			default: {
+			}
+		}
+		ret.push_back(d);
+	}
+	return ret;
+}
+
+bool ImagePipeline::_is_fusable(const Step &p_step, Image::Format p_format) const {
+	switch (p_step.type) {
+		case STEP_REPLACE_COLOR: {
+			return image_get_8bit_pixel_size(p_format) > 0;
+		}
+		case STEP_BINARIZE: {
+			// Adaptive binarization depends on neighboring pixels.
+			return p_step.threshold >= 0 &&
+					(p_format == Image::FORMAT_L8 || p_format == Image::FORMAT_R8 ||
+							p_format == Image::FORMAT_RGB8 || p_format == Image::FORMAT_RGBA8);
+		}
+		default: {
+			return false;
+		}
+	}
+}
+
+int ImagePipeline::_process_fused(Ref<Image> &r_image, bool &r_owned, int p_from) const {
+	const Image::Format src_format = r_image->get_format();
+	Image::Format format = src_format;
+	bool binarized = false;
+
+	LocalVector<_FusedOp> ops;
+	int i = p_from;
+	for (; i < steps.size() && _is_fusable(steps[i], format); ++i) {
+		const Step &s = steps[i];
+		_FusedOp op;
+		op.pixel_size = image_get_8bit_pixel_size(format);
+
+		if (s.type == STEP_BINARIZE) {
+			op.binarize = true;
+			op.luminance = op.pixel_size >= 3;
+			op.threshold = uint8_t(CLAMP(s.threshold * 255.0, 0, 255));
+			op.below = s.invert ? 255 : 0;
+			op.above = s.invert ? 0 : 255;
+			format = Image::FORMAT_L8;
+			binarized = true;
+		} else {
+			if (s.color == s.with_color && s.tolerance <= 0.0) {
+				continue;
+			}
+			if (!image_get_pixel_range(format, s.color, s.tolerance, op.range)) {
+				continue; // The color cannot occur in this format.
+			}
+			const PoolVector<uint8_t> encoded = image_encode_pixel(format, s.with_color);
+			memcpy(op.with, encoded.read().ptr(), op.pixel_size);
+		}
+		ops.push_back(op);
+	}
+	if (ops.empty()) {
+		return i;
+	}
+	const int width = r_image->get_width();
+	const int height = r_image->get_height();
+	const bool mipmaps = r_image->has_mipmaps() && !binarized;
+
+	_FusedPass pass;
+	pass.ops = ops.ptr();
+	pass.op_count = ops.size();
+	pass.src_size = image_get_8bit_pixel_size(src_format);
+	pass.dst_size = image_get_8bit_pixel_size(format);
+	pass.width = width;
+	const int thread_count = image_get_thread_count(width, height);
+
+	PoolVector<uint8_t> data = r_image->get_data();
+	if (binarized) {
+		// Same as `GoostImage.binarize()`, mipmaps are not preserved. Pixels
+		// are written to new data, so that rows can be processed in parallel,
+		// and the input is never copied.
+		PoolVector<uint8_t> dst;
+		dst.resize(Image::get_image_data_size(width, height, format));
+		{
+			PoolVector<uint8_t>::Read r = data.read();
+			PoolVector<uint8_t>::Write w = dst.write();
+			pass.src = r.ptr();
+			pass.dst = w.ptr();
+			image_process_rows(&pass, height, thread_count);
+		}
+		data = dst;
+	} else {
+		// Release the image, so that data is only copied on write when it's
+		// still shared with the input image.
+		r_image = Ref<Image>();
+
+		PoolVector<uint8_t>::Write w = data.write();
+		pass.src = w.ptr();
+		pass.dst = w.ptr();
+		image_process_rows(&pass, height, thread_count);
+	}
+	r_image.instance();
+	r_image->create(width, height, mipmaps, format, data);
+	r_owned = true;
+
+	return i;
+}
+
+Ref<Image> ImagePipeline::process(const Ref<Image> &p_image) const {
+	ERR_FAIL_COND_V(p_image.is_null(), Ref<Image>());
+	ERR_FAIL_COND_V(p_image->empty(), Ref<Image>());
+	ERR_FAIL_COND_V_MSG(p_image->is_compressed(), Ref<Image>(), "Cannot process compressed image.");
+
+	// The input image is shared until the first step which modifies it.
+	Ref<Image> image = p_image;
+	bool owned = false;
+
+	// Consecutive Leptonica steps share data, see `ImagePix`.
+	Ref<ImagePix> pix;
+
+	int i = 0;
+	while (i < steps.size()) {
+		const Step &s = steps[i];
+		const bool leptonica = s.type == STEP_BINARIZE || s.type == STEP_MORPH || s.type == STEP_ROTATE;
+
+		if (pix.is_null() && _is_fusable(s, image->get_format())) {
+			i = _process_fused(image, owned, i);
+			continue;
+		}
+		if (leptonica) {
+			if (pix.is_null()) {
+				pix.instance();
+				pix->create_from_image(image);
+				ERR_FAIL_COND_V(pix->empty(), Ref<Image>());
+			}
+			switch (s.type) {
+				case STEP_BINARIZE: {
+					pix->binarize(s.threshold, s.invert);
+				} break;
+				case STEP_MORPH: {
+					pix->morph(_GoostImage::MorphOperation(s.operation), s.kernel_size);
+				} break;
+				case STEP_ROTATE: {
+					pix->rotate(s.angle, s.expand);
+				} break;
+				default: {
+				}
+			}
+			++i;
+			continue;
+		}
+		if (pix.is_valid()) {
+			image = pix->get_image();
+			owned = true;
+			pix.unref();
+			continue; // Steps on image data may be fusable now.
+		}
+		switch (s.type) {
+			case STEP_REPLACE_COLOR: {
+				if (!owned) {
+					image = image->duplicate();
+					owned = true;
+				}
+				GoostImage::replace_color(image, s.color, s.with_color, s.tolerance);
+			} break;
+			case STEP_TILE: {
+				image = GoostImage::tile(image, s.size, s.wrap_mode);
+				ERR_FAIL_COND_V(image.is_null(), Ref<Image>());
+				owned = true;
+			} break;
+			case STEP_BLEND: {
+				Ref<Image> src = s.image;
+				if (src.is_null() || src->empty()) {
+					break;
+				}
+				if (src->get_format() != image->get_format()) {
+					src = src->duplicate();
+					src->convert(image->get_format());
+				}
+				if (!owned) {
+					image = image->duplicate();
+					owned = true;
+				}
+				image->blend_rect(src, Rect2(Point2(), src->get_size()), s.position);
+			} break;
+			default: {
+			}
+		}
+		++i;
+	}
+	if (pix.is_valid()) {
+		return pix->get_image();
+	}
+	if (!owned) {
+		return p_image->duplicate();
+	}
+	return image;
+}
+
+void ImagePipeline::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("add_replace_color", "color", "with_color", "tolerance"), &ImagePipeline::add_replace_color, DEFVAL(0.0));
+	ClassDB::bind_method(D_METHOD("add_binarize", "threshold", "invert"), &ImagePipeline::add_binarize, DEFVAL(-1), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("add_morph", "operation", "kernel_size"), &ImagePipeline::add_morph, DEFVAL(Vector2(3, 3)));
+	ClassDB::bind_method(D_METHOD("add_rotate", "angle", "expand"), &ImagePipeline::add_rotate, DEFVAL(true));
+	ClassDB::bind_method(D_METHOD("add_tile", "size", "wrap_mode"), &ImagePipeline::add_tile, DEFVAL(_GoostImage::TILE));
+	ClassDB::bind_method(D_METHOD("add_blend", "image", "position"), &ImagePipeline::add_blend, DEFVAL(Vector2()));
+
+	ClassDB::bind_method(D_METHOD("get_step_count"), &ImagePipeline::get_step_count);
+	ClassDB::bind_method(D_METHOD("get_step_type", "index"), &ImagePipeline::get_step_type);
+	ClassDB::bind_method(D_METHOD("remove_step", "index"), &ImagePipeline::remove_step);
+	ClassDB::bind_method(D_METHOD("clear_steps"), &ImagePipeline::clear_steps);
+
+	ClassDB::bind_method(D_METHOD("set_steps", "steps"), &ImagePipeline::set_steps);
+	ClassDB::bind_method(D_METHOD("get_steps"), &ImagePipeline::get_steps);
+
+	ClassDB::bind_method(D_METHOD("process", "image"), &ImagePipeline::process);
+
+	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "steps"), "set_steps", "get_steps");
+
+	BIND_ENUM_CONSTANT(STEP_REPLACE_COLOR);
+	BIND_ENUM_CONSTANT(STEP_BINARIZE);
+	BIND_ENUM_CONSTANT(STEP_MORPH);
+	BIND_ENUM_CONSTANT(STEP_ROTATE);
+	BIND_ENUM_CONSTANT(STEP_TILE);
+	BIND_ENUM_CONSTANT(STEP_BLEND);
+	BIND_ENUM_CONSTANT(STEP_MAX);
+}
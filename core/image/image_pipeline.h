@@ -0,0 +1,79 @@
+#pragma once
+
+#include "core/image.h"
+#include "core/resource.h"
+
+#include "goost_image.h"
+#include "goost_image_bind.h"
+
+// A sequence of image processing steps applied at once. Consecutive per-pixel
+// steps are fused into a single pass over image data, and consecutive steps
+// implemented by Leptonica operate on the same `PIX` data without converting
+// to `Image` in between.
+class ImagePipeline : public Resource {
+	GDCLASS(ImagePipeline, Resource);
+
+public:
+	enum StepType {
+		STEP_REPLACE_COLOR,
+		STEP_BINARIZE,
+		STEP_MORPH,
+		STEP_ROTATE,
+		STEP_TILE,
+		STEP_BLEND,
+		STEP_MAX,
+	};
+
+private:
+	struct Step {
+		StepType type = STEP_REPLACE_COLOR;
+
+		Color color;
+		Color with_color;
+		real_t tolerance = 0.0;
+
+		real_t threshold = -1;
+		bool invert = false;
+
+		GoostImage::MorphOperation operation = GoostImage::MORPH_DILATE;
+		Size2i kernel_size = Size2i(3, 3);
+
+		real_t angle = 0.0;
+		bool expand = true;
+
+		Size2i size;
+		GoostImage::WrapMode wrap_mode = GoostImage::TILE;
+
+		Ref<Image> image;
+		Point2i position;
+	};
+	Vector<Step> steps;
+
+	void _add_step(const Step &p_step);
+	bool _is_fusable(const Step &p_step, Image::Format p_format) const;
+	int _process_fused(Ref<Image> &r_image, bool &r_owned, int p_from) const;
+
+protected:
+	static void _bind_methods();
+
+public:
+	void add_replace_color(const Color &p_color, const Color &p_with_color, real_t p_tolerance = 0.0);
+	void add_binarize(real_t p_threshold = -1, bool p_invert = false);
+	void add_morph(_GoostImage::MorphOperation p_op, const Vector2 &p_kernel_size = Size2i(3, 3));
+	void add_rotate(real_t p_angle, bool p_expand = true);
+	void add_tile(const Vector2 &p_size, _GoostImage::WrapMode p_mode = _GoostImage::TILE);
+	void add_blend(const Ref<Image> &p_image, const Vector2 &p_position = Vector2());
+
+	int get_step_count() const { return steps.size(); }
+	StepType get_step_type(int p_index) const;
+	void remove_step(int p_index);
+	void clear_steps();
+
+	void set_steps(const Array &p_steps);
+	Array get_steps() const;
+
+	// Returns a new image, the input image is not modified.
+	Ref<Image> process(const Ref<Image> &p_image) const;
+};
+
+VARIANT_ENUM_CAST(ImagePipeline::StepType);
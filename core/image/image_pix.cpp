@@ -0,0 +1,137 @@
+#include "image_pix.h"
+
+#include "goost_image.h"
+
+#include "goost/thirdparty/leptonica/allheaders.h"
+
+// Defined in `goost_image.cpp`.
+PIX *pix_create_from_image(Ref<Image> p_image);
+Ref<Image> image_create_from_pix(PIX *p_pix, bool p_include_alpha = true);
+
+PIX *pix_rotate(PIX *p_pix, real_t p_angle, bool p_expand);
+PIX *pix_binarize(PIX *p_pix, real_t p_threshold, bool p_invert);
+PIX *pix_morph(PIX *p_pix, GoostImage::MorphOperation p_op, const Size2i &p_kernel_size);
+Point2 pix_get_centroid(PIX *p_pix);
+Color pix_get_pixel_average(PIX *p_pix, const Rect2 &p_rect, PIX *p_mask);
+
+void ImagePix::_set_pix(PIX *p_pix) {
+	ERR_FAIL_COND_MSG(!p_pix, "Invalid image data.");
+	if (pix) {
+		pixDestroy(&pix);
+	}
+	pix = p_pix;
+}
+
+void ImagePix::create_from_image(const Ref<Image> &p_image) {
+	ERR_FAIL_COND(p_image.is_null());
+	ERR_FAIL_COND(p_image->empty());
+	ERR_FAIL_COND_MSG(p_image->is_compressed(), "Cannot create from compressed image.");
+
+	Ref<Image> image = p_image;
+	const Image::Format format = image->get_format();
+	if (format != Image::FORMAT_L8 && format != Image::FORMAT_R8 && format != Image::FORMAT_RGBA8) {
+		// Only 8 and 32 bpp data can be represented, and conversion
+		// must not change the format of the original image.
+		image = p_image->duplicate();
+		image->convert(Image::FORMAT_RGBA8);
+	}
+	_set_pix(pix_create_from_image(image));
+}
+
+Ref<Image> ImagePix::get_image() const {
+	ERR_FAIL_COND_V(!pix, Ref<Image>());
+	return image_create_from_pix(pix);
+}
+
+int ImagePix::get_width() const {
+	return pix ? pixGetWidth(pix) : 0;
+}
+
+int ImagePix::get_height() const {
+	return pix ? pixGetHeight(pix) : 0;
+}
+
+Vector2 ImagePix::get_size() const {
+	return Vector2(get_width(), get_height());
+}
+
+void ImagePix::rotate(real_t p_angle, bool p_expand) {
+	ERR_FAIL_COND(!pix);
+	_set_pix(pix_rotate(pix, p_angle, p_expand));
+}
+
+void ImagePix::rotate_90(_GoostImage::Direction p_direction) {
+	ERR_FAIL_COND(!pix);
+	_set_pix(pixRotate90(pix, static_cast<int>(p_direction)));
+}
+
+void ImagePix::rotate_180() {
+	ERR_FAIL_COND(!pix);
+	_set_pix(pixRotate180(nullptr, pix));
+}
+
+void ImagePix::binarize(real_t p_threshold, bool p_invert) {
+	ERR_FAIL_COND(!pix);
+	_set_pix(pix_binarize(pix, p_threshold, p_invert));
+}
+
+void ImagePix::dilate(int p_kernel_size) {
+	morph(_GoostImage::MORPH_DILATE, Size2i(p_kernel_size, p_kernel_size));
+}
+
+void ImagePix::erode(int p_kernel_size) {
+	morph(_GoostImage::MORPH_ERODE, Size2i(p_kernel_size, p_kernel_size));
+}
+
+void ImagePix::morph(_GoostImage::MorphOperation p_op, const Vector2 &p_kernel_size) {
+	ERR_FAIL_COND(!pix);
+	PIX *pix_out = pix_morph(pix, GoostImage::MorphOperation(p_op), p_kernel_size);
+	if (!pix_out) {
+		return;
+	}
+	_set_pix(pix_out);
+}
+
+Vector2 ImagePix::get_centroid() const {
+	ERR_FAIL_COND_V(!pix, Vector2());
+	return pix_get_centroid(pix);
+}
+
+Color ImagePix::get_pixel_average(const Rect2 &p_rect, const Ref<ImagePix> &p_mask) const {
+	ERR_FAIL_COND_V(!pix, Color());
+	PIX *pix_mask = nullptr;
+	if (p_mask.is_valid()) {
+		ERR_FAIL_COND_V(p_mask->empty(), Color());
+		pix_mask = p_mask->pix;
+	}
+	return pix_get_pixel_average(pix, p_rect, pix_mask);
+}
+
+ImagePix::~ImagePix() {
+	if (pix) {
+		pixDestroy(&pix);
+	}
+}
+
+void ImagePix::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("create_from_image", "image"), &ImagePix::create_from_image);
+	ClassDB::bind_method(D_METHOD("get_image"), &ImagePix::get_image);
+
+	ClassDB::bind_method(D_METHOD("get_width"), &ImagePix::get_width);
+	ClassDB::bind_method(D_METHOD("get_height"), &ImagePix::get_height);
+	ClassDB::bind_method(D_METHOD("get_size"), &ImagePix::get_size);
+	ClassDB::bind_method(D_METHOD("empty"), &ImagePix::empty);
+
+	ClassDB::bind_method(D_METHOD("rotate", "angle", "expand"), &ImagePix::rotate, DEFVAL(true));
+	ClassDB::bind_method(D_METHOD("rotate_90", "direction"), &ImagePix::rotate_90);
+	ClassDB::bind_method(D_METHOD("rotate_180"), &ImagePix::rotate_180);
+
+	ClassDB::bind_method(D_METHOD("binarize", "threshold", "invert"), &ImagePix::binarize, DEFVAL(-1), DEFVAL(false));
+
+	ClassDB::bind_method(D_METHOD("dilate", "kernel_size"), &ImagePix::dilate, DEFVAL(3));
+	ClassDB::bind_method(D_METHOD("erode", "kernel_size"), &ImagePix::erode, DEFVAL(3));
+	ClassDB::bind_method(D_METHOD("morph", "operation", "kernel_size"), &ImagePix::morph, DEFVAL(Vector2(3, 3)));
+
+	ClassDB::bind_method(D_METHOD("get_centroid"), &ImagePix::get_centroid);
+	ClassDB::bind_method(D_METHOD("get_pixel_average", "rect", "mask"), &ImagePix::get_pixel_average, DEFVAL(Rect2()), DEFVAL(Variant()));
+}
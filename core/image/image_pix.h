@@ -0,0 +1,45 @@
+#pragma once
+
+#include "core/image.h"
+#include "core/reference.h"
+
+#include "goost_image_bind.h"
+
+typedef struct Pix PIX;
+
+// Image data kept in Leptonica's memory layout, so that chained operations do
+// not convert pixels back and forth between `Image` and `PIX` on each step.
+class ImagePix : public Reference {
+	GDCLASS(ImagePix, Reference);
+
+	PIX *pix = nullptr;
+
+	void _set_pix(PIX *p_pix);
+
+protected:
+	static void _bind_methods();
+
+public:
+	void create_from_image(const Ref<Image> &p_image);
+	Ref<Image> get_image() const;
+
+	int get_width() const;
+	int get_height() const;
+	Vector2 get_size() const;
+	bool empty() const { return pix == nullptr; }
+
+	void rotate(real_t p_angle, bool p_expand = true);
+	void rotate_90(_GoostImage::Direction p_direction);
+	void rotate_180();
+
+	void binarize(real_t p_threshold = -1, bool p_invert = false);
+
+	void dilate(int p_kernel_size = 3);
+	void erode(int p_kernel_size = 3);
+	void morph(_GoostImage::MorphOperation p_op, const Vector2 &p_kernel_size = Size2i(3, 3));
+
+	Vector2 get_centroid() const;
+	Color get_pixel_average(const Rect2 &p_rect = Rect2(), const Ref<ImagePix> &p_mask = Ref<ImagePix>()) const;
+
+	~ImagePix();
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "core/image.h"
+#include "core/os/thread_work_pool.h"
+
+// Helpers for processing raw data of images with 8 bits per channel, defined
+// in `goost_image.cpp`.
+
+// Range of byte values per channel which decode to a color within tolerance.
+struct PixelRange {
+	uint8_t lo[4] = {};
+	uint8_t hi[4] = {};
+
+	_FORCE_INLINE_ bool has(const uint8_t *p_pixel, int p_pixel_size) const {
+		bool inside = true;
+		for (int i = 0; i < p_pixel_size; ++i) {
+			inside = inside && p_pixel[i] >= lo[i] && p_pixel[i] <= hi[i];
+		}
+		return inside;
+	}
+};
+
+// Returns 0 for formats which are not 8 bits per channel.
+int image_get_8bit_pixel_size(Image::Format p_format);
+
+// Returns the color as encoded by `Image::set_pixel()` in the given format.
+PoolVector<uint8_t> image_encode_pixel(Image::Format p_format, const Color &p_color);
+
+// Returns false if no pixel in the format can match the color, for instance,
+// when looking for a translucent color in an image without alpha channel.
+bool image_get_pixel_range(Image::Format p_format, const Color &p_color, real_t p_tolerance, PixelRange &r_range);
+
+// Same weights and rounding as in Leptonica's `pixConvertRGBToLuminance()`,
+// so that results match operations implemented with Leptonica.
+_FORCE_INLINE_ uint8_t image_get_luminance(const uint8_t *p_rgb) {
+	return uint8_t(0.3f * p_rgb[0] + 0.5f * p_rgb[1] + 0.2f * p_rgb[2] + 0.5);
+}
+
+// Returns the number of threads to process an image with, limited by the
+// `goost/image/max_threads` project setting. Small images are processed on
+// the calling thread.
+int image_get_thread_count(int p_width, int p_height);
+
+template <class C>
+struct _ImageRowBands {
+	C *instance = nullptr;
+	int height = 0;
+	int count = 0;
+
+	void process_band(uint32_t p_band, void *p_userdata) {
+		const int from = int64_t(height) * p_band / count;
+		const int to = int64_t(height) * (p_band + 1) / count;
+		instance->process_rows(p_band, from, to);
+	}
+};
+
+// Splits rows into as many bands as there are threads, and calls
+// `process_rows(band, from, to)` on the instance for each band. Bands may
+// be processed concurrently, so they must not write to shared data. If
+// `p_pool` is given, bands are processed by its threads instead of starting
+// new ones, which is useful when processing many small regions in a row.
+template <class C>
+void image_process_rows(C *p_instance, int p_height, int p_thread_count, ThreadWorkPool *p_pool = nullptr) {
+	if (p_thread_count <= 1) {
+		p_instance->process_rows(0, 0, p_height);
+		return;
+	}
+	_ImageRowBands<C> bands;
+	bands.instance = p_instance;
+	bands.height = p_height;
+	bands.count = p_thread_count;
+
+	if (p_pool) {
+		p_pool->do_work(p_thread_count, &bands, &_ImageRowBands<C>::process_band, (void *)nullptr);
+		return;
+	}
+	ThreadWorkPool pool;
+	pool.init(p_thread_count);
+	pool.do_work(p_thread_count, &bands, &_ImageRowBands<C>::process_band, (void *)nullptr);
+	pool.finish();
+}
@@ -1,6 +1,7 @@
 #include "register_image_types.h"
 
 #include "core/engine.h"
+#include "core/project_settings.h"
 
 #include "drivers/png/image_loader_indexed_png.h"
 #include "drivers/png/resource_saver_indexed_png.h"
@@ -14,6 +15,11 @@ static Ref<ResourceSaverIndexedPNG> resource_saver_indexed_png;
 namespace goost {
 
 void register_image_types() {
+	// Limits the number of threads used to process large images, see `image_get_thread_count()`.
+	GLOBAL_DEF("goost/image/max_threads", 0);
+	ProjectSettings::get_singleton()->set_custom_property_info("goost/image/max_threads",
+			PropertyInfo(Variant::INT, "goost/image/max_threads", PROPERTY_HINT_RANGE, "0,256,1"));
+
 #ifdef GOOST_GoostImage
 	_goost_image = memnew(_GoostImage);
 	ClassDB::register_class<_GoostImage>();
@@ -27,6 +33,12 @@ void register_image_types() {
 
 	resource_saver_indexed_png.instance();
 	ResourceSaver::add_resource_format_saver(resource_saver_indexed_png);
+#endif
+#ifdef GOOST_ImagePix
+	ClassDB::register_class<ImagePix>();
+#endif
+#ifdef GOOST_ImagePipeline
+	ClassDB::register_class<ImagePipeline>();
 #endif
 	ClassDB::register_class<ImageBlender>();
 }
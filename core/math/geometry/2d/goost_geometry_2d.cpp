@@ -75,6 +75,76 @@ Vector<Vector<Point2>> GoostGeometry2D::deflate_polyline(const Vector<Point2> &p
 	return PolyOffset2D::deflate_polylines(polylines, p_delta);
 }
 
+// Appends a stroke of `p_width` along the polyline to the mesh. Segments
+// are connected with miter joins, which are clamped for sharp angles.
+void GoostGeometry2D::stroke_polyline(const Vector<Point2> &p_polyline, real_t p_width, bool p_closed, Vector<Point2> &r_vertices, Vector<int> &r_indices) {
+	const real_t miter_limit = 4.0;
+	const real_t half_width = p_width * 0.5;
+
+	// Consecutive duplicate points have no direction.
+	Vector<Point2> points;
+	points.resize(p_polyline.size());
+	Point2 *pts = points.ptrw();
+	int count = 0;
+	for (int i = 0; i < p_polyline.size(); ++i) {
+		if (count == 0 || !pts[count - 1].is_equal_approx(p_polyline[i])) {
+			pts[count++] = p_polyline[i];
+		}
+	}
+	if (p_closed && count > 1 && pts[0].is_equal_approx(pts[count - 1])) {
+		--count;
+	}
+	if (count < 2 || (p_closed && count < 3)) {
+		return;
+	}
+	const int base = r_vertices.size();
+	r_vertices.resize(base + count * 2);
+	Point2 *vertices = r_vertices.ptrw() + base;
+
+	for (int i = 0; i < count; ++i) {
+		const bool has_prev = p_closed || i > 0;
+		const bool has_next = p_closed || i < count - 1;
+		const Point2 &p = pts[i];
+
+		Vector2 normal;
+		real_t length = half_width;
+		if (has_prev && has_next) {
+			const Point2 &prev = pts[(i + count - 1) % count];
+			const Point2 &next = pts[(i + 1) % count];
+			const Vector2 n0 = (p - prev).normalized().tangent();
+			const Vector2 n1 = (next - p).normalized().tangent();
+			normal = n0 + n1;
+			if (normal.length_squared() < CMP_EPSILON) {
+				normal = n1; // Segments go back on themselves.
+			} else {
+				normal.normalize();
+				length = half_width / MAX(normal.dot(n1), 1.0 / miter_limit);
+			}
+		} else if (has_next) {
+			normal = (pts[i + 1] - p).normalized().tangent();
+		} else {
+			normal = (p - pts[i - 1]).normalized().tangent();
+		}
+		vertices[i * 2 + 0] = p + normal * length;
+		vertices[i * 2 + 1] = p - normal * length;
+	}
+	const int segments = p_closed ? count : count - 1;
+	const int index_base = r_indices.size();
+	r_indices.resize(index_base + segments * 6);
+	int *indices = r_indices.ptrw() + index_base;
+
+	for (int i = 0; i < segments; ++i) {
+		const int a = base + i * 2;
+		const int b = base + ((i + 1) % count) * 2;
+		indices[i * 6 + 0] = a;
+		indices[i * 6 + 1] = a + 1;
+		indices[i * 6 + 2] = b;
+		indices[i * 6 + 3] = a + 1;
+		indices[i * 6 + 4] = b + 1;
+		indices[i * 6 + 5] = b;
+	}
+}
+
 Vector<Vector<Point2>> GoostGeometry2D::triangulate_polygon(const Vector<Point2> &p_polygon) {
 	Vector<Vector<Point2>> polygons;
 	polygons.push_back(p_polygon);
@@ -115,66 +185,241 @@ struct IndicesStack {
 };
 
 // Polyline decimation using Ramer-Douglas-Peucker (RDP) algorithm.
-Vector<Point2> GoostGeometry2D::simplify_polyline(const Vector<Point2> &p_polyline, real_t p_epsilon) {
-	if (p_polyline.size() <= 2) {
+// Scratch buffers shared between polylines, so that simplifying a batch of
+// polylines does not allocate per polyline.
+struct SimplifyScratch {
+	// Ramer-Douglas-Peucker.
+	LocalVector<uint8_t> retain;
+	IndicesStack parts;
+
+	// Visvalingam-Whyatt.
+	struct AreaEntry {
+		real_t area;
+		int index;
+
+		_FORCE_INLINE_ bool operator<(const AreaEntry &p_other) const {
+			return area == p_other.area ? index < p_other.index : area < p_other.area;
+		}
+	};
+	LocalVector<AreaEntry> heap; // Binary min-heap.
+	LocalVector<real_t> areas; // Current area per point, negative if removed.
+	LocalVector<int> prev;
+	LocalVector<int> next;
+
+	void heap_push(const AreaEntry &p_entry) {
+		heap.push_back(p_entry);
+		AreaEntry *h = heap.ptr();
+		uint32_t i = heap.size() - 1;
+		while (i > 0) {
+			const uint32_t parent = (i - 1) / 2;
+			if (!(h[i] < h[parent])) {
+				break;
+			}
+			SWAP(h[i], h[parent]);
+			i = parent;
+		}
+	}
+
+	AreaEntry heap_pop() {
+		AreaEntry *h = heap.ptr();
+		const AreaEntry top = h[0];
+		const uint32_t size = heap.size() - 1;
+		h[0] = h[size];
+		heap.resize(size);
+		uint32_t i = 0;
+		while (true) {
+			const uint32_t left = 2 * i + 1;
+			if (left >= size) {
+				break;
+			}
+			uint32_t child = left;
+			if (left + 1 < size && h[left + 1] < h[left]) {
+				child = left + 1;
+			}
+			if (!(h[child] < h[i])) {
+				break;
+			}
+			SWAP(h[i], h[child]);
+			i = child;
+		}
+		return top;
+	}
+};
+
+// Returns the index of the point farthest from the segment between the first
+// and last points, and its squared distance. The distance is computed via the
+// cross product with precomputed reciprocal length, which keeps the loop body
+// free of divisions and branches besides the running maximum.
+static _FORCE_INLINE_ int _farthest_point(const Point2 *p_points, int p_first, int p_last, real_t &r_distance) {
+	const Point2 a = p_points[p_first];
+	const Vector2 n = p_points[p_last] - a;
+	const real_t length_squared = n.dot(n);
+
+	int index = p_first;
+	real_t distance_max = 0.0;
+
+	if (length_squared > CMP_EPSILON2) {
+		const real_t inv_length_squared = 1.0 / length_squared;
+		for (int i = p_first + 1; i < p_last; ++i) {
+			const real_t c = n.cross(p_points[i] - a);
+			const real_t distance = c * c * inv_length_squared;
+			if (distance > distance_max) {
+				index = i;
+				distance_max = distance;
+			}
+		}
+	} else {
+		// Closed polyline, measure distance to the endpoint instead.
+		for (int i = p_first + 1; i < p_last; ++i) {
+			const real_t distance = (p_points[i] - a).length_squared();
+			if (distance > distance_max) {
+				index = i;
+				distance_max = distance;
+			}
+		}
+	}
+	r_distance = distance_max;
+	return index;
+}
+
+static Vector<Point2> _simplify_polyline(const Vector<Point2> &p_polyline, real_t p_epsilon, SimplifyScratch &r_scratch) {
+	const int count = p_polyline.size();
+	if (count <= 2) {
 		return p_polyline;
 	}
 	if (p_epsilon <= 0.0) {
 		// Retain all points.
 		return p_polyline;
 	}
-	Vector<bool> points_to_retain;
-	points_to_retain.resize(p_polyline.size());
-
-	bool *retain = points_to_retain.ptrw();
-	memset(retain, 0, points_to_retain.size());
+	const Point2 *points = p_polyline.ptr();
 
-	real_t eps = MAX(0.0, p_epsilon);
-	real_t distance_max = 0;
-	real_t distance = 0;
+	r_scratch.retain.resize(count);
+	uint8_t *retain = r_scratch.retain.ptr();
+	memset(retain, 0, count);
 
-	IndicesStack parts;
-	parts.stack.reserve(p_polyline.size() * 2);
+	IndicesStack &parts = r_scratch.parts;
+	parts.stack.reserve(count * 2);
 	parts.push_back(0);
-	parts.push_back(p_polyline.size() - 1);
+	parts.push_back(count - 1);
 
-	retain[parts[0]] = true;
-	retain[parts[1]] = true;
-	int index = 0;
+	retain[0] = 1;
+	retain[count - 1] = 1;
+	int retained = 2;
 
 	while (!parts.is_empty()) {
-		int second = parts.pop_back(); // Pop back in other order.
-		int first = parts.pop_back();
-
-		distance_max = 0;
-		Vector2 a = p_polyline[first];
-		Vector2 b = p_polyline[second];
-		Vector2 n = b - a;
-
-		for (int i = first + 1; i < second; ++i) {
-			Vector2 pa = a - p_polyline[i];
-			Vector2 c = n * pa.dot(n) / n.dot(n);
-			Vector2 d = pa - c;
-			distance = d.dot(d);
-			if (distance > distance_max) {
-				index = i;
-				distance_max = distance;
-			}
-		}
-		if (distance_max >= eps) {
-			retain[index] = true;
+		const int second = parts.pop_back(); // Pop back in other order.
+		const int first = parts.pop_back();
+
+		real_t distance_max;
+		const int index = _farthest_point(points, first, second, distance_max);
+
+		if (distance_max >= p_epsilon) {
+			retain[index] = 1;
+			++retained;
 			parts.push_back(first);
 			parts.push_back(index);
 			parts.push_back(index);
 			parts.push_back(second);
 		}
 	}
-	Vector<Vector2> ret;
-	for (int i = 0; i < p_polyline.size(); ++i) {
+	Vector<Point2> ret;
+	ret.resize(retained);
+	Point2 *w = ret.ptrw();
+	for (int i = 0, j = 0; i < count; ++i) {
 		if (retain[i]) {
-			ret.push_back(p_polyline[i]);
+			w[j++] = points[i];
+		}
+	}
+	return ret;
+}
+
+Vector<Point2> GoostGeometry2D::simplify_polyline(const Vector<Point2> &p_polyline, real_t p_epsilon) {
+	SimplifyScratch scratch;
+	return _simplify_polyline(p_polyline, p_epsilon, scratch);
+}
+
+Vector<Vector<Point2>> GoostGeometry2D::simplify_polylines(const Vector<Vector<Point2>> &p_polylines, real_t p_epsilon) {
+	Vector<Vector<Point2>> ret;
+	ret.resize(p_polylines.size());
+
+	SimplifyScratch scratch;
+	int max_count = 0;
+	for (int i = 0; i < p_polylines.size(); ++i) {
+		max_count = MAX(max_count, p_polylines[i].size());
+	}
+	scratch.retain.reserve(max_count);
+	scratch.parts.stack.reserve(max_count * 2);
+
+	Vector<Point2> *w = ret.ptrw();
+	for (int i = 0; i < p_polylines.size(); ++i) {
+		w[i] = _simplify_polyline(p_polylines[i], p_epsilon, scratch);
+	}
+	return ret;
+}
+
+static _FORCE_INLINE_ real_t _triangle_area(const Point2 &p_a, const Point2 &p_b, const Point2 &p_c) {
+	return Math::abs((p_b - p_a).cross(p_c - p_a)) * 0.5;
+}
+
+Vector<Point2> GoostGeometry2D::decimate_polyline(const Vector<Point2> &p_polyline, int p_point_count) {
+	const int count = p_polyline.size();
+	const int target = MAX(2, p_point_count);
+	if (count <= target) {
+		return p_polyline;
+	}
+	const Point2 *points = p_polyline.ptr();
+
+	SimplifyScratch s;
+	s.areas.resize(count);
+	s.prev.resize(count);
+	s.next.resize(count);
+	s.heap.reserve(count * 3);
+
+	real_t *areas = s.areas.ptr();
+	int *prev = s.prev.ptr();
+	int *next = s.next.ptr();
+
+	for (int i = 0; i < count; ++i) {
+		prev[i] = i - 1;
+		next[i] = i + 1;
+	}
+	areas[0] = 0.0;
+	areas[count - 1] = 0.0;
+	for (int i = 1; i < count - 1; ++i) {
+		areas[i] = _triangle_area(points[i - 1], points[i], points[i + 1]);
+		s.heap_push({ areas[i], i });
+	}
+	int remaining = count;
+	while (remaining > target) {
+		const SimplifyScratch::AreaEntry e = s.heap_pop();
+		const int i = e.index;
+		if (e.area != areas[i]) {
+			continue; // Outdated entry, or the point is already removed.
+		}
+		const int p = prev[i];
+		const int n = next[i];
+		next[p] = n;
+		prev[n] = p;
+		areas[i] = -1.0;
+		--remaining;
+
+		// Neighbors never get less significant than the removed point, so
+		// that points are eliminated in the order of their effective area.
+		if (p > 0) {
+			areas[p] = MAX(e.area, _triangle_area(points[prev[p]], points[p], points[n]));
+			s.heap_push({ areas[p], p });
+		}
+		if (n < count - 1) {
+			areas[n] = MAX(e.area, _triangle_area(points[p], points[n], points[next[n]]));
+			s.heap_push({ areas[n], n });
 		}
 	}
+	Vector<Point2> ret;
+	ret.resize(remaining);
+	Point2 *w = ret.ptrw();
+	for (int i = 0, j = 0; i < count; i = next[i]) {
+		w[j++] = points[i];
+	}
 	return ret;
 }
 
@@ -183,7 +428,21 @@ Vector<Point2> GoostGeometry2D::simplify_polyline(const Vector<Point2> &p_polyli
 // "On the Parameterization of Catmull-Rom Curves" by Cem Yuksel, Scott Schaefer, John Keyser.
 // https://people.engr.tamu.edu/schaefer/research/catmull_rom.pdf
 //
-static Vector2 catmull_rom(const Vector2 &p0, const Vector2 &p1, const Vector2 &p2, const Vector2 &p3, float p_t, float p_alpha) {
+// Knots depend only on control points, so they are computed once per segment
+// rather than per sample.
+static void catmull_rom_knots(const Vector2 &p0, const Vector2 &p1, const Vector2 &p2, const Vector2 &p3, float p_alpha, real_t *r_knots) {
+	auto compute_t = [&](float t, float alpha, const Vector2 &v0, const Vector2 &v1) {
+		real_t a = (v1.x - v0.x) * (v1.x - v0.x) + (v1.y - v0.y) * (v1.y - v0.y);
+		real_t b = Math::pow(a, alpha * 0.5f);
+		return b + t;
+	};
+	r_knots[0] = 0.0;
+	r_knots[1] = compute_t(r_knots[0], p_alpha, p0, p1);
+	r_knots[2] = compute_t(r_knots[1], p_alpha, p1, p2);
+	r_knots[3] = compute_t(r_knots[2], p_alpha, p2, p3);
+}
+
+static Vector2 catmull_rom(const Vector2 &p0, const Vector2 &p1, const Vector2 &p2, const Vector2 &p3, const real_t *p_knots, float p_t, float p_alpha) {
 	Vector2 c;
 	if (p_alpha > 0.0f) {
 		// Centripetal (alpha == 0.5) or chordal (alpha > 0.5).
@@ -191,15 +450,10 @@ static Vector2 catmull_rom(const Vector2 &p0, const Vector2 &p1, const Vector2 &
 		// Division by zero...
 		ERR_FAIL_COND_V_MSG(p0 == p1 || p1 == p2 || p2 == p3, Vector2(), "Duplicate points detected, cannot interpolate.");
 #endif
-		auto compute_t = [&](float t, float alpha, const Vector2 &v0, const Vector2 &v1) {
-			real_t a = (v1.x - v0.x) * (v1.x - v0.x) + (v1.y - v0.y) * (v1.y - v0.y);
-			real_t b = Math::pow(a, alpha * 0.5f);
-			return b + t;
-		};
-		real_t t0 = 0.0;
-		real_t t1 = compute_t(t0, p_alpha, p0, p1);
-		real_t t2 = compute_t(t1, p_alpha, p1, p2);
-		real_t t3 = compute_t(t2, p_alpha, p2, p3);
+		const real_t t0 = p_knots[0];
+		const real_t t1 = p_knots[1];
+		const real_t t2 = p_knots[2];
+		const real_t t3 = p_knots[3];
 		real_t t = Math::lerp(t1, t2, p_t);
 		Vector2 a1 = (t1 - t) / (t1 - t0) * p0 + (t - t0) / (t1 - t0) * p1;
 		Vector2 a2 = (t2 - t) / (t2 - t1) * p1 + (t - t1) / (t2 - t1) * p2;
@@ -236,13 +490,15 @@ Vector<Point2> GoostGeometry2D::smooth_polyline(const Vector<Point2> &p_polyline
 	const Point2 *p = pts.ptr();
 	Vector<Point2> smoothed;
 	for (int i = 0; i < pts.size() - 3; ++i) {
+		real_t knots[4];
+		catmull_rom_knots(p[i + 0], p[i + 1], p[i + 2], p[i + 3], p_alpha, knots);
 		// Weighted distribution.
 		const real_t segment_length = p[i + 1].distance_to(p[i + 2]);
 		const int pc = Math::ceil(point_count * segment_length / length);
 		for (int j = 0; j < pc; ++j) {
 			real_t t = 1.0 / pc * j;
 			smoothed.push_back(catmull_rom(
-					p[i + 0], p[i + 1], p[i + 2], p[i + 3], t, p_alpha));
+					p[i + 0], p[i + 1], p[i + 2], p[i + 3], knots, t, p_alpha));
 		}
 	}
 	smoothed.push_back(p[pts.size() - 2]);
@@ -265,18 +521,182 @@ Vector<Point2> GoostGeometry2D::smooth_polygon(const Vector<Point2> &p_polygon,
 	};
 	Vector<Point2> smoothed;
 	for (int i = 0; i < s; ++i) {
+		real_t knots[4];
+		catmull_rom_knots(pt(i - 1), pt(i + 0), pt(i + 1), pt(i + 2), p_alpha, knots);
 		// Weighted distribution.
 		const real_t segment_length = pt(i + 0).distance_to(pt(i + 1));
 		const int pc = Math::ceil(point_count * segment_length / perimeter);
 		for (int j = 0; j < pc; ++j) {
 			real_t t = 1.0 / pc * j;
 			smoothed.push_back(catmull_rom(
-					pt(i - 1), pt(i + 0), pt(i + 1), pt(i + 2), t, p_alpha));
+					pt(i - 1), pt(i + 0), pt(i + 1), pt(i + 2), knots, t, p_alpha));
 		}
 	}
 	return smoothed;
 }
 
+// Adaptive Catmull-Rom smoothing. Each segment is converted to a cubic Bezier
+// curve (the Catmull-Rom spline with knots `t` is a cubic Hermite spline with
+// non-uniform tangents), which is then flattened by recursive subdivision.
+// Subdivision stops once the control points are close enough to the chord,
+// so that straight parts produce no extra points and tight curves produce many.
+//
+// "Piecewise Linear Approximation of Bezier Curves" by Roger Willcocks.
+//
+static const int SMOOTH_ADAPTIVE_MAX_DEPTH = 16;
+
+struct CubicBezier {
+	Point2 p[4];
+	int depth = 0;
+};
+
+static _FORCE_INLINE_ bool _bezier_is_flat(const CubicBezier &p_curve, real_t p_tolerance_sq16) {
+	const Point2 *b = p_curve.p;
+	real_t ux = 3.0 * b[1].x - 2.0 * b[0].x - b[3].x;
+	real_t uy = 3.0 * b[1].y - 2.0 * b[0].y - b[3].y;
+	real_t vx = 3.0 * b[2].x - 2.0 * b[3].x - b[0].x;
+	real_t vy = 3.0 * b[2].y - 2.0 * b[3].y - b[0].y;
+	ux *= ux;
+	uy *= uy;
+	vx *= vx;
+	vy *= vy;
+	return MAX(ux, vx) + MAX(uy, vy) <= p_tolerance_sq16;
+}
+
+// Appends points of the curve past the first point, up to and including the last one.
+static void _flatten_bezier(const CubicBezier &p_curve, real_t p_tolerance, LocalVector<Point2> &r_points) {
+	const real_t tolerance_sq16 = 16.0 * p_tolerance * p_tolerance;
+
+	CubicBezier stack[SMOOTH_ADAPTIVE_MAX_DEPTH + 1];
+	int stack_size = 0;
+	stack[stack_size++] = p_curve;
+
+	while (stack_size > 0) {
+		const CubicBezier c = stack[--stack_size];
+		if (c.depth >= SMOOTH_ADAPTIVE_MAX_DEPTH || _bezier_is_flat(c, tolerance_sq16)) {
+			r_points.push_back(c.p[3]);
+			continue;
+		}
+		// De Casteljau subdivision at t = 0.5.
+		const Point2 p01 = (c.p[0] + c.p[1]) * 0.5;
+		const Point2 p12 = (c.p[1] + c.p[2]) * 0.5;
+		const Point2 p23 = (c.p[2] + c.p[3]) * 0.5;
+		const Point2 p012 = (p01 + p12) * 0.5;
+		const Point2 p123 = (p12 + p23) * 0.5;
+		const Point2 mid = (p012 + p123) * 0.5;
+
+		// Right half is processed last.
+		CubicBezier &right = stack[stack_size++];
+		right.p[0] = mid;
+		right.p[1] = p123;
+		right.p[2] = p23;
+		right.p[3] = c.p[3];
+		right.depth = c.depth + 1;
+
+		CubicBezier &left = stack[stack_size++];
+		left.p[0] = c.p[0];
+		left.p[1] = p01;
+		left.p[2] = p012;
+		left.p[3] = mid;
+		left.depth = c.depth + 1;
+	}
+}
+
+// Smoothes segments between `p_points[1]` and `p_points[p_count - 2]`, other
+// points only act as control points. Appends all points except the last one.
+static void _smooth_adaptive(const Point2 *p_points, int p_count, real_t p_tolerance, float p_alpha, LocalVector<Point2> &r_points) {
+	// Knot intervals are shared by adjacent segments, so compute them once.
+	LocalVector<real_t> intervals;
+	intervals.resize(p_count - 1);
+	for (int i = 0; i < p_count - 1; ++i) {
+		const real_t d = p_alpha > 0.0f ? Math::pow((real_t)p_points[i].distance_squared_to(p_points[i + 1]), p_alpha * 0.5f) : 1.0;
+		// Zero intervals only occur with duplicate points, whose terms vanish
+		// from tangents below.
+		intervals[i] = d > 0.0 ? d : 1.0;
+	}
+	for (int i = 0; i < p_count - 3; ++i) {
+		const Point2 &p0 = p_points[i + 0];
+		const Point2 &p1 = p_points[i + 1];
+		const Point2 &p2 = p_points[i + 2];
+		const Point2 &p3 = p_points[i + 3];
+		if (p1 == p2) {
+			continue; // Degenerate segment.
+		}
+		const real_t d0 = intervals[i + 0];
+		const real_t d1 = intervals[i + 1];
+		const real_t d2 = intervals[i + 2];
+
+		// Tangents at `p1` and `p2`, scaled to the segment's parameter range.
+		const Vector2 m1 = d1 * ((p1 - p0) / d0 - (p2 - p0) / (d0 + d1) + (p2 - p1) / d1);
+		const Vector2 m2 = d1 * ((p2 - p1) / d1 - (p3 - p1) / (d1 + d2) + (p3 - p2) / d2);
+
+		CubicBezier curve;
+		curve.p[0] = p1;
+		curve.p[1] = p1 + m1 / 3.0;
+		curve.p[2] = p2 - m2 / 3.0;
+		curve.p[3] = p2;
+
+		r_points.push_back(p1);
+		_flatten_bezier(curve, p_tolerance, r_points);
+		r_points.resize(r_points.size() - 1); // Pushed by the next segment.
+	}
+}
+
+Vector<Point2> GoostGeometry2D::smooth_polyline_adaptive(const Vector<Point2> &p_polyline, real_t p_tolerance, float p_alpha) {
+	ERR_FAIL_COND_V_MSG(p_polyline.size() < 3, Vector<Point2>(),
+			"Cannot smooth polyline: requires at least 3 points for interpolation.");
+	ERR_FAIL_COND_V_MSG(p_tolerance <= 0.0, p_polyline, "Tolerance must be greater than zero.");
+
+	const int s = p_polyline.size();
+	const Point2 *p = p_polyline.ptr();
+
+	// Extrapolate first and last points to act as control points.
+	LocalVector<Point2> pts;
+	pts.resize(s + 2);
+	pts[0] = p[0] + (p[0] - p[1]);
+	for (int i = 0; i < s; ++i) {
+		pts[i + 1] = p[i];
+	}
+	pts[s + 1] = p[s - 1] + (p[s - 1] - p[s - 2]);
+
+	LocalVector<Point2> smoothed;
+	smoothed.reserve(s * 2);
+	_smooth_adaptive(pts.ptr(), pts.size(), p_tolerance, p_alpha, smoothed);
+	smoothed.push_back(p[s - 1]);
+
+	Vector<Point2> ret;
+	ret.resize(smoothed.size());
+	memcpy(ret.ptrw(), smoothed.ptr(), sizeof(Point2) * smoothed.size());
+	return ret;
+}
+
+Vector<Point2> GoostGeometry2D::smooth_polygon_adaptive(const Vector<Point2> &p_polygon, real_t p_tolerance, float p_alpha) {
+	ERR_FAIL_COND_V_MSG(p_polygon.size() < 3, Vector<Point2>(), "Bad polygon!");
+	ERR_FAIL_COND_V_MSG(p_tolerance <= 0.0, p_polygon, "Tolerance must be greater than zero.");
+
+	const int s = p_polygon.size();
+	const Point2 *p = p_polygon.ptr();
+
+	// Wrap around, so that every edge gets its control points.
+	LocalVector<Point2> pts;
+	pts.resize(s + 3);
+	pts[0] = p[s - 1];
+	for (int i = 0; i < s; ++i) {
+		pts[i + 1] = p[i];
+	}
+	pts[s + 1] = p[0];
+	pts[s + 2] = p[1];
+
+	LocalVector<Point2> smoothed;
+	smoothed.reserve(s * 2);
+	_smooth_adaptive(pts.ptr(), pts.size(), p_tolerance, p_alpha, smoothed);
+
+	Vector<Point2> ret;
+	ret.resize(smoothed.size());
+	memcpy(ret.ptrw(), smoothed.ptr(), sizeof(Point2) * smoothed.size());
+	return ret;
+}
+
 // Approximate polygon smoothing using Chaikin's corner-cutting algorithm.
 // https://www.cs.unc.edu/~dm/UNC/COMP258/LECTURES/Chaikins-Algorithm.pdf
 //
@@ -409,44 +829,73 @@ int GoostGeometry2D::point_in_polygon(const Point2 &p_point, const Vector<Point2
 	ERR_FAIL_COND_V(p_polygon.size() < 3, 0);
 
 	int pip_result = 0;
-	Point2 ip = p_polygon[0];
-	const Point2 &pt = p_point;
-
-	for (int i = 1; i <= p_polygon.size(); ++i) {
-		const Point2 &ip_next = i == p_polygon.size() ? p_polygon[0] : p_polygon[i];
-		if (ip_next.y == pt.y) {
-			if ((ip_next.x == pt.x) || (ip.y == pt.y && ((ip_next.x > pt.x) == (ip.x < pt.x)))) {
-				return -1;
+	const Point2 *ptr = p_polygon.ptr();
+	const int count = p_polygon.size();
+
+	for (int i = 0; i < count; ++i) {
+		const int crossing = point_in_polygon_edge(p_point, ptr[i], ptr[i + 1 == count ? 0 : i + 1]);
+		if (crossing < 0) {
+			return -1;
+		}
+		pip_result ^= crossing;
+	}
+	return pip_result;
+}
+
+Vector<int> GoostGeometry2D::points_in_polygon(const Vector<Point2> &p_points, const Vector<Point2> &p_polygon) {
+	Vector<int> ret;
+	ERR_FAIL_COND_V(p_polygon.size() < 3, ret);
+	ret.resize(p_points.size());
+
+	const Point2 *points = p_points.ptr();
+	const Point2 *polygon = p_polygon.ptr();
+	const int polygon_size = p_polygon.size();
+	int *results = ret.ptrw();
+
+	// Points are processed in blocks, iterating over edges in the outer loop,
+	// so that each edge is loaded once per block rather than once per point.
+	const int BLOCK_SIZE = 64;
+	Point2 block[BLOCK_SIZE];
+	int block_indices[BLOCK_SIZE];
+	uint8_t crossings[BLOCK_SIZE];
+	uint8_t on_boundary[BLOCK_SIZE];
+
+	const Rect2 rect = bounding_rect(p_polygon);
+	const Point2 rect_end = rect.position + rect.size;
+
+	for (int start = 0; start < p_points.size(); start += BLOCK_SIZE) {
+		const int end = MIN(start + BLOCK_SIZE, p_points.size());
+		// Only points within the bounding rect (including borders) need testing.
+		int count = 0;
+		for (int i = start; i < end; ++i) {
+			const Point2 &p = points[i];
+			if (p.x < rect.position.x || p.y < rect.position.y || p.x > rect_end.x || p.y > rect_end.y) {
+				results[i] = 0;
+				continue;
 			}
+			block[count] = p;
+			block_indices[count] = i;
+			crossings[count] = 0;
+			on_boundary[count] = 0;
+			++count;
 		}
-		if ((ip.y < pt.y) != (ip_next.y < pt.y)) {
-			if (ip.x >= pt.x) {
-				if (ip_next.x > pt.x) {
-					pip_result = 1 - pip_result;
-				} else {
-					const real_t d = (ip.x - pt.x) * (ip_next.y - pt.y) - (ip_next.x - pt.x) * (ip.y - pt.y);
-					if (!d) {
-						return -1;
-					}
-					if ((d > 0) == (ip_next.y > ip.y)) {
-						pip_result = 1 - pip_result;
-					}
-				}
-			} else {
-				if (ip_next.x > pt.x) {
-					const real_t d = (ip.x - pt.x) * (ip_next.y - pt.y) - (ip_next.x - pt.x) * (ip.y - pt.y);
-					if (!d) {
-						return -1;
-					}
-					if ((d > 0) == (ip_next.y > ip.y)) {
-						pip_result = 1 - pip_result;
-					}
-				}
+		if (count == 0) {
+			continue;
+		}
+		for (int e = 0; e < polygon_size; ++e) {
+			const Point2 &a = polygon[e];
+			const Point2 &b = polygon[e + 1 == polygon_size ? 0 : e + 1];
+			for (int j = 0; j < count; ++j) {
+				const int c = point_in_polygon_edge(block[j], a, b);
+				on_boundary[j] |= c < 0;
+				crossings[j] ^= c > 0;
 			}
 		}
-		ip = ip_next;
+		for (int j = 0; j < count; ++j) {
+			results[block_indices[j]] = on_boundary[j] ? -1 : crossings[j];
+		}
 	}
-	return pip_result;
+	return ret;
 }
 
 Vector<Point2> GoostGeometry2D::rectangle(const Point2 &p_extents) {
@@ -16,6 +16,8 @@ public:
 	static Vector<Vector<Point2>> inflate_polygon(const Vector<Point2> &p_polygon, real_t p_delta);
 	static Vector<Vector<Point2>> deflate_polygon(const Vector<Point2> &p_polygon, real_t p_delta);
 	static Vector<Vector<Point2>> deflate_polyline(const Vector<Point2> &p_polyline, real_t p_delta);
+	// Appends triangles covering the polyline with the given width to the mesh.
+	static void stroke_polyline(const Vector<Point2> &p_polyline, real_t p_width, bool p_closed, Vector<Point2> &r_vertices, Vector<int> &r_indices);
 
 	/* Polygon decomposition */
 	static Vector<Vector<Point2>> triangulate_polygon(const Vector<Point2> &p_polygon);
@@ -24,9 +26,13 @@ public:
 	/* Polygon/Polyline smoothing and simplification */
 	static Vector<Point2> smooth_polygon(const Vector<Point2> &p_polygon, float p_density, float p_alpha = 0.5f);
 	static Vector<Point2> smooth_polyline(const Vector<Point2> &p_polyline, float p_density, float p_alpha = 0.5f);
+	static Vector<Point2> smooth_polygon_adaptive(const Vector<Point2> &p_polygon, real_t p_tolerance, float p_alpha = 0.5f);
+	static Vector<Point2> smooth_polyline_adaptive(const Vector<Point2> &p_polyline, real_t p_tolerance, float p_alpha = 0.5f);
 	static Vector<Point2> smooth_polygon_approx(const Vector<Point2> &p_polygon, int p_iterations = 1, float p_cut_distance = 0.25f);
 	static Vector<Point2> smooth_polyline_approx(const Vector<Point2> &p_polyline, int p_iterations = 1, float p_cut_distance = 0.25f);
 	static Vector<Point2> simplify_polyline(const Vector<Point2> &p_polyline, real_t p_epsilon);
+	static Vector<Vector<Point2>> simplify_polylines(const Vector<Vector<Point2>> &p_polylines, real_t p_epsilon);
+	static Vector<Point2> decimate_polyline(const Vector<Point2> &p_polyline, int p_point_count);
 
 	/* Polygon/Polyline attributes */
 	static Point2 polygon_centroid(const Vector<Point2> &p_polygon);
@@ -37,6 +43,34 @@ public:
 
 	// Returns 0 if false, +1 if true, -1 if point is exactly on the polygon's boundary.
 	static int point_in_polygon(const Point2 &p_point, const Vector<Point2> &p_polygon);
+	// Same as `point_in_polygon()`, but for many points at once.
+	static Vector<int> points_in_polygon(const Vector<Point2> &p_points, const Vector<Point2> &p_polygon);
+	// A single step of `point_in_polygon()` for an edge from `p_a` to `p_b`.
+	// Returns -1 if the point lies on the edge, 1 if the edge crosses the ray
+	// cast from the point, 0 otherwise. Edges which do not span the point's
+	// y-coordinate (inclusively) always return 0, so can be skipped entirely.
+	static _FORCE_INLINE_ int point_in_polygon_edge(const Point2 &p_point, const Point2 &p_a, const Point2 &p_b) {
+		const Point2 &pt = p_point;
+		if (p_b.y == pt.y) {
+			if ((p_b.x == pt.x) || (p_a.y == pt.y && ((p_b.x > pt.x) == (p_a.x < pt.x)))) {
+				return -1;
+			}
+		}
+		if ((p_a.y < pt.y) == (p_b.y < pt.y)) {
+			return 0;
+		}
+		if (p_a.x >= pt.x && p_b.x > pt.x) {
+			return 1;
+		}
+		if (p_a.x < pt.x && p_b.x <= pt.x) {
+			return 0;
+		}
+		const real_t d = (p_a.x - pt.x) * (p_b.y - pt.y) - (p_b.x - pt.x) * (p_a.y - pt.y);
+		if (!d) {
+			return -1;
+		}
+		return (d > 0) == (p_b.y > p_a.y) ? 1 : 0;
+	}
 
 	/* Polygon/primitive generation methods */
 	static Vector<Point2> rectangle(const Point2 &p_extents);
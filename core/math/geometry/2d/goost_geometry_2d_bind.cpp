@@ -84,6 +84,16 @@ Array _GoostGeometry2D::deflate_polyline(const Vector<Point2> &p_polyline, real_
 	return ret;
 }
 
+Array _GoostGeometry2D::stroke_polyline(const Vector<Point2> &p_polyline, real_t p_width, bool p_closed) const {
+	Vector<Point2> vertices;
+	Vector<int> indices;
+	GoostGeometry2D::stroke_polyline(p_polyline, p_width, p_closed, vertices, indices);
+	Array ret;
+	ret.push_back(vertices);
+	ret.push_back(indices);
+	return ret;
+}
+
 Array _GoostGeometry2D::triangulate_polygon(const Vector<Point2> &p_polygon) const {
 	Vector<Vector<Vector2>> solution = GoostGeometry2D::triangulate_polygon(p_polygon);
 	Array ret;
@@ -106,6 +116,24 @@ Vector<Point2> _GoostGeometry2D::simplify_polyline(const Vector<Point2> &p_polyl
 	return GoostGeometry2D::simplify_polyline(p_polyline, p_epsilon);
 }
 
+Array _GoostGeometry2D::simplify_polylines(const Array &p_polylines, real_t p_epsilon) const {
+	Vector<Vector<Point2>> polylines;
+	polylines.resize(p_polylines.size());
+	for (int i = 0; i < p_polylines.size(); ++i) {
+		polylines.write[i] = p_polylines[i];
+	}
+	Vector<Vector<Point2>> solution = GoostGeometry2D::simplify_polylines(polylines, p_epsilon);
+	Array ret;
+	for (int i = 0; i < solution.size(); ++i) {
+		ret.push_back(solution[i]);
+	}
+	return ret;
+}
+
+Vector<Point2> _GoostGeometry2D::decimate_polyline(const Vector<Point2> &p_polyline, int p_point_count) const {
+	return GoostGeometry2D::decimate_polyline(p_polyline, p_point_count);
+}
+
 Vector<Point2> _GoostGeometry2D::smooth_polygon(const Vector<Point2> &p_polygon, float p_density, float p_alpha) const {
 	return GoostGeometry2D::smooth_polygon(p_polygon, p_density, p_alpha);
 }
@@ -114,6 +142,14 @@ Vector<Point2> _GoostGeometry2D::smooth_polyline(const Vector<Point2> &p_polylin
 	return GoostGeometry2D::smooth_polyline(p_polyline, p_density, p_alpha);
 }
 
+Vector<Point2> _GoostGeometry2D::smooth_polygon_adaptive(const Vector<Point2> &p_polygon, real_t p_tolerance, float p_alpha) const {
+	return GoostGeometry2D::smooth_polygon_adaptive(p_polygon, p_tolerance, p_alpha);
+}
+
+Vector<Point2> _GoostGeometry2D::smooth_polyline_adaptive(const Vector<Point2> &p_polyline, real_t p_tolerance, float p_alpha) const {
+	return GoostGeometry2D::smooth_polyline_adaptive(p_polyline, p_tolerance, p_alpha);
+}
+
 Vector<Point2> _GoostGeometry2D::smooth_polygon_approx(const Vector<Point2> &p_polygon, int p_iterations, float cut_distance) const {
 	return GoostGeometry2D::smooth_polygon_approx(p_polygon, p_iterations, cut_distance);
 }
@@ -146,6 +182,10 @@ int _GoostGeometry2D::point_in_polygon(const Point2 &p_point, const Vector<Point
 	return GoostGeometry2D::point_in_polygon(p_point, p_polygon);
 }
 
+Vector<int> _GoostGeometry2D::points_in_polygon(const Vector<Point2> &p_points, const Vector<Point2> &p_polygon) const {
+	return GoostGeometry2D::points_in_polygon(p_points, p_polygon);
+}
+
 Vector<Point2> _GoostGeometry2D::rectangle(const Vector2 &p_extents) const {
 	return GoostGeometry2D::rectangle(p_extents);
 }
@@ -210,13 +250,18 @@ void _GoostGeometry2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("inflate_polygon", "polygon", "delta"), &_GoostGeometry2D::inflate_polygon);
 	ClassDB::bind_method(D_METHOD("deflate_polygon", "polygon", "delta"), &_GoostGeometry2D::deflate_polygon);
 	ClassDB::bind_method(D_METHOD("deflate_polyline", "polyline", "delta"), &_GoostGeometry2D::deflate_polyline);
+	ClassDB::bind_method(D_METHOD("stroke_polyline", "polyline", "width", "closed"), &_GoostGeometry2D::stroke_polyline, DEFVAL(false));
 
 	ClassDB::bind_method(D_METHOD("triangulate_polygon", "polygon"), &_GoostGeometry2D::triangulate_polygon);
 	ClassDB::bind_method(D_METHOD("decompose_polygon", "polygon"), &_GoostGeometry2D::decompose_polygon);
 
 	ClassDB::bind_method(D_METHOD("simplify_polyline", "polyline", "epsilon"), &_GoostGeometry2D::simplify_polyline);
+	ClassDB::bind_method(D_METHOD("simplify_polylines", "polylines", "epsilon"), &_GoostGeometry2D::simplify_polylines);
+	ClassDB::bind_method(D_METHOD("decimate_polyline", "polyline", "point_count"), &_GoostGeometry2D::decimate_polyline);
 	ClassDB::bind_method(D_METHOD("smooth_polygon", "polygon", "density", "alpha"), &_GoostGeometry2D::smooth_polygon, DEFVAL(0.5f));
 	ClassDB::bind_method(D_METHOD("smooth_polyline", "polyline", "density", "alpha"), &_GoostGeometry2D::smooth_polyline, DEFVAL(0.5f));
+	ClassDB::bind_method(D_METHOD("smooth_polygon_adaptive", "polygon", "tolerance", "alpha"), &_GoostGeometry2D::smooth_polygon_adaptive, DEFVAL(0.5f));
+	ClassDB::bind_method(D_METHOD("smooth_polyline_adaptive", "polyline", "tolerance", "alpha"), &_GoostGeometry2D::smooth_polyline_adaptive, DEFVAL(0.5f));
 	ClassDB::bind_method(D_METHOD("smooth_polygon_approx", "polygon", "iterations", "cut_distance"), &_GoostGeometry2D::smooth_polygon_approx, DEFVAL(1), DEFVAL(0.25f));
 	ClassDB::bind_method(D_METHOD("smooth_polyline_approx", "polyline", "iterations", "cut_distance"), &_GoostGeometry2D::smooth_polyline_approx, DEFVAL(1), DEFVAL(0.25f));
 
@@ -227,6 +272,7 @@ void _GoostGeometry2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("bounding_rect", "points"), &_GoostGeometry2D::bounding_rect);
 
 	ClassDB::bind_method(D_METHOD("point_in_polygon", "point", "polygon"), &_GoostGeometry2D::point_in_polygon);
+	ClassDB::bind_method(D_METHOD("points_in_polygon", "points", "polygon"), &_GoostGeometry2D::points_in_polygon);
 
 	ClassDB::bind_method(D_METHOD("rectangle", "extents"), &_GoostGeometry2D::rectangle);
 	ClassDB::bind_method(D_METHOD("circle", "radius", "max_error"), &_GoostGeometry2D::circle, DEFVAL(0.25));
@@ -25,15 +25,20 @@ public:
 	Array inflate_polygon(const Vector<Point2> &p_polygon, real_t p_delta) const;
 	Array deflate_polygon(const Vector<Point2> &p_polygon, real_t p_delta) const;
 	Array deflate_polyline(const Vector<Point2> &p_polyline, real_t p_delta) const;
+	Array stroke_polyline(const Vector<Point2> &p_polyline, real_t p_width, bool p_closed = false) const;
 
 	Array triangulate_polygon(const Vector<Point2> &p_polygon) const;
 	Array decompose_polygon(const Vector<Point2> &p_polygon) const;
 
 	Vector<Point2> smooth_polygon(const Vector<Point2> &p_polygon, float p_density, float p_alpha = 0.5f) const;
 	Vector<Point2> smooth_polyline(const Vector<Point2> &p_polyline, float p_density, float p_alpha = 0.5f) const;
+	Vector<Point2> smooth_polygon_adaptive(const Vector<Point2> &p_polygon, real_t p_tolerance, float p_alpha = 0.5f) const;
+	Vector<Point2> smooth_polyline_adaptive(const Vector<Point2> &p_polyline, real_t p_tolerance, float p_alpha = 0.5f) const;
 	Vector<Point2> smooth_polygon_approx(const Vector<Point2> &p_polygon, int p_iterations = 1, float cut_distance = 0.25f) const;
 	Vector<Point2> smooth_polyline_approx(const Vector<Point2> &p_polyline, int p_iterations = 1, float cut_distance = 0.25f) const;
 	Vector<Point2> simplify_polyline(const Vector<Point2> &p_polyline, real_t p_epsilon) const;
+	Array simplify_polylines(const Array &p_polylines, real_t p_epsilon) const;
+	Vector<Point2> decimate_polyline(const Vector<Point2> &p_polyline, int p_point_count) const;
 
 	Vector2 polygon_centroid(const Vector<Vector2> &p_polygon) const;
 	real_t polygon_area(const Vector<Vector2> &p_polygon) const;
@@ -42,6 +47,7 @@ public:
 	Rect2 bounding_rect(const Vector<Point2> &p_points) const;
 
 	int point_in_polygon(const Point2 &p_point, const Vector<Point2> &p_polygon) const;
+	Vector<int> points_in_polygon(const Vector<Point2> &p_points, const Vector<Point2> &p_polygon) const;
 
 	Vector<Point2> rectangle(const Vector2 &p_extents) const;
 	Vector<Point2> circle(real_t p_radius, real_t p_max_error) const;
@@ -1,47 +1,58 @@
 #include "poly_boolean_clipper10.h"
 #include "goost/core/math/geometry/2d/goost_geometry_2d.h"
+#include "goost/core/math/geometry/2d/poly/utils/clipper_scratch_paths.h"
 #include "goost/core/math/geometry/2d/poly/utils/godot_clipper10_path_convert.h"
 
-Vector<Vector<Point2>> PolyBoolean2DClipper10::boolean_polypaths(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op) {
-	clipperlib::Clipper clp = configure(p_op, parameters);
+static thread_local clipperlib::Paths subject_buffer;
+static thread_local clipperlib::Paths clip_buffer;
 
-	clipperlib::Paths subject;
-	GodotClipperUtils::scale_up_polypaths(p_polypaths_a, subject);
-	clp.AddPaths(subject, clipperlib::ptSubject, subject_open);
+Vector<Vector<Point2>> PolyBoolean2DClipper10::boolean_polypaths(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters) {
+	ClipperScratchPaths<clipperlib::Paths> subject(subject_buffer);
+	ClipperScratchPaths<clipperlib::Paths> clip(clip_buffer);
+	GodotClipperUtils::scale_up_polypaths(p_polypaths_a, subject.get());
+	GodotClipperUtils::scale_up_polypaths(p_polypaths_b, clip.get());
 
-	if (!p_polypaths_b.empty()) { // Optional for merge operation.
-		clipperlib::Paths clip;
-		GodotClipperUtils::scale_up_polypaths(p_polypaths_b, clip);
-		clp.AddPaths(clip, clipperlib::ptClip, false);
-	}
-
-	clipperlib::Paths solution_closed, solution_open;
-	clp.Execute(clip_type, solution_closed, solution_open, subject_fill_rule);
+	const clipperlib::Paths &solution = boolean_paths(subject.get(), clip.get(), p_op, p_parameters);
 
 	Vector<Vector<Point2>> ret;
-	GodotClipperUtils::scale_down_polypaths(subject_open ? solution_open : solution_closed, ret);
+	GodotClipperUtils::scale_down_polypaths(solution, ret);
 
 	return ret;
 }
 
-void PolyBoolean2DClipper10::boolean_polypaths_tree(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op, PolyNode2D *r_root) {
+clipperlib::Paths PolyBoolean2DClipper10::boolean_paths(const clipperlib::Paths &p_paths_a, const clipperlib::Paths &p_paths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters) {
+	const Config cfg = configure(p_op, p_parameters);
+	clipperlib::Clipper clp;
+
+	clp.AddPaths(p_paths_a, clipperlib::ptSubject, cfg.subject_open);
+	if (!p_paths_b.empty()) { // Optional for merge operation.
+		clp.AddPaths(p_paths_b, clipperlib::ptClip, false);
+	}
+	clipperlib::Paths solution_closed, solution_open;
+	clp.Execute(cfg.clip_type, solution_closed, solution_open, cfg.subject_fill_rule);
+
+	return cfg.subject_open ? solution_open : solution_closed;
+}
+
+void PolyBoolean2DClipper10::boolean_polypaths_tree(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters, PolyNode2D *r_root) {
 	ERR_FAIL_NULL(r_root);
 
-	clipperlib::Clipper clp = configure(p_op, parameters);
+	const Config cfg = configure(p_op, p_parameters);
+	clipperlib::Clipper clp;
 
-	clipperlib::Paths subject;
-	GodotClipperUtils::scale_up_polypaths(p_polypaths_a, subject);
-	clp.AddPaths(subject, clipperlib::ptSubject, subject_open);
+	ClipperScratchPaths<clipperlib::Paths> subject(subject_buffer);
+	GodotClipperUtils::scale_up_polypaths(p_polypaths_a, subject.get());
+	clp.AddPaths(subject.get(), clipperlib::ptSubject, cfg.subject_open);
 
 	if (!p_polypaths_b.empty()) { // Optional for merge operation.
-		clipperlib::Paths clip;
-		GodotClipperUtils::scale_up_polypaths(p_polypaths_b, clip);
-		clp.AddPaths(clip, clipperlib::ptClip, false);
+		ClipperScratchPaths<clipperlib::Paths> clip(clip_buffer);
+		GodotClipperUtils::scale_up_polypaths(p_polypaths_b, clip.get());
+		clp.AddPaths(clip.get(), clipperlib::ptClip, false);
 	}
 
 	clipperlib::PolyPath tree;
 	clipperlib::Paths solution_open; // Ignored here but required.
-	clp.Execute(clip_type, tree, solution_open, subject_fill_rule);
+	clp.Execute(cfg.clip_type, tree, solution_open, cfg.subject_fill_rule);
 
 	List<clipperlib::PolyPath *> to_visit;
 	Map<clipperlib::PolyPath *, PolyNode2D *> nodes;
@@ -64,29 +75,30 @@ void PolyBoolean2DClipper10::boolean_polypaths_tree(const Vector<Vector<Point2>>
 	}
 }
 
-clipperlib::Clipper PolyBoolean2DClipper10::configure(Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters) {
+PolyBoolean2DClipper10::Config PolyBoolean2DClipper10::configure(Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters) {
 	using namespace clipperlib;
 
+	Config cfg;
 	switch (p_op) {
 		case OP_NONE:
-			clip_type = ctNone;
+			cfg.clip_type = ctNone;
 			break;
 		case OP_UNION:
-			clip_type = ctUnion;
+			cfg.clip_type = ctUnion;
 			break;
 		case OP_DIFFERENCE:
-			clip_type = ctDifference;
+			cfg.clip_type = ctDifference;
 			break;
 		case OP_INTERSECTION:
-			clip_type = ctIntersection;
+			cfg.clip_type = ctIntersection;
 			break;
 		case OP_XOR:
-			clip_type = ctXor;
+			cfg.clip_type = ctXor;
 			break;
 	}
-	subject_fill_rule = FillRule(p_parameters->subject_fill_rule);
-	clip_fill_rule = FillRule(p_parameters->clip_fill_rule);
-	subject_open = p_parameters->subject_open;
+	cfg.subject_fill_rule = FillRule(p_parameters->subject_fill_rule);
+	cfg.clip_fill_rule = FillRule(p_parameters->clip_fill_rule);
+	cfg.subject_open = p_parameters->subject_open;
 
-	return Clipper();
+	return cfg;
 }
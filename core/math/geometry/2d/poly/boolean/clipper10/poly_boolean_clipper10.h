@@ -5,14 +5,16 @@
 
 class PolyBoolean2DClipper10 : public PolyBoolean2DBackend {
 public:
-	virtual Vector<Vector<Point2>> boolean_polypaths(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op);
-	virtual void boolean_polypaths_tree(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op, PolyNode2D *r_root);
+	virtual Vector<Vector<Point2>> boolean_polypaths(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters);
+	virtual void boolean_polypaths_tree(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters, PolyNode2D *r_root);
+	virtual clipperlib::Paths boolean_paths(const clipperlib::Paths &p_paths_a, const clipperlib::Paths &p_paths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters);
 
 private:
-	clipperlib::Clipper configure(Operation p_op, const Ref<PolyBooleanParameters2D> &p_params);
-	clipperlib::ClipType clip_type;
-	clipperlib::FillRule subject_fill_rule;
-	clipperlib::FillRule clip_fill_rule;
-	bool subject_open;
+	struct Config {
+		clipperlib::ClipType clip_type;
+		clipperlib::FillRule subject_fill_rule;
+		clipperlib::FillRule clip_fill_rule;
+		bool subject_open;
+	};
+	static Config configure(Operation p_op, const Ref<PolyBooleanParameters2D> &p_params);
 };
-
@@ -1,52 +1,76 @@
 #include "poly_boolean_clipper6.h"
 #include "goost/core/math/geometry/2d/goost_geometry_2d.h"
+#include "goost/core/math/geometry/2d/poly/utils/clipper_scratch_paths.h"
 #include "goost/core/math/geometry/2d/poly/utils/godot_clipper6_path_convert.h"
 
-Vector<Vector<Point2>> PolyBoolean2DClipper6::boolean_polypaths(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op) {
-	ClipperLib::Clipper clp = configure(p_op, parameters);
+static thread_local ClipperLib::Paths subject_buffer;
+static thread_local ClipperLib::Paths clip_buffer;
 
-	ClipperLib::Paths subject;
-	GodotClipperUtils::scale_up_polypaths(p_polypaths_a, subject);
-	clp.AddPaths(subject, ClipperLib::ptSubject, !subject_open);
+Vector<Vector<Point2>> PolyBoolean2DClipper6::boolean_polypaths(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters) {
+	ClipperScratchPaths<ClipperLib::Paths> subject(subject_buffer);
+	ClipperScratchPaths<ClipperLib::Paths> clip(clip_buffer);
+	GodotClipperUtils::scale_up_polypaths(p_polypaths_a, subject.get());
+	GodotClipperUtils::scale_up_polypaths(p_polypaths_b, clip.get());
 
-	if (!p_polypaths_b.empty()) { // Optional for merge operation.
-		ClipperLib::Paths clip;
-		GodotClipperUtils::scale_up_polypaths(p_polypaths_b, clip);
-		clp.AddPaths(clip, ClipperLib::ptClip, true);
-	}
+	const ClipperLib::Paths solution = execute(subject.get(), clip.get(), p_op, p_parameters);
+
+	Vector<Vector<Point2>> ret;
+	GodotClipperUtils::scale_down_polypaths(solution, ret);
+
+	return ret;
+}
+
+clipperlib::Paths PolyBoolean2DClipper6::boolean_paths(const clipperlib::Paths &p_paths_a, const clipperlib::Paths &p_paths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters) {
+	ClipperScratchPaths<ClipperLib::Paths> subject(subject_buffer);
+	ClipperScratchPaths<ClipperLib::Paths> clip(clip_buffer);
+	GodotClipperUtils::copy_polypaths(p_paths_a, subject.get());
+	GodotClipperUtils::copy_polypaths(p_paths_b, clip.get());
+
+	const ClipperLib::Paths solution = execute(subject.get(), clip.get(), p_op, p_parameters);
+
+	clipperlib::Paths ret;
+	GodotClipperUtils::copy_polypaths(solution, ret);
 
+	return ret;
+}
+
+ClipperLib::Paths PolyBoolean2DClipper6::execute(const ClipperLib::Paths &p_subject, const ClipperLib::Paths &p_clip, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters) {
+	const Config cfg = configure(p_op, p_parameters);
+	ClipperLib::Clipper clp(cfg.init_options);
+
+	clp.AddPaths(p_subject, ClipperLib::ptSubject, !cfg.subject_open);
+	if (!p_clip.empty()) { // Optional for merge operation.
+		clp.AddPaths(p_clip, ClipperLib::ptClip, true);
+	}
 	ClipperLib::Paths solution;
-	if (!subject_open) {
-		clp.Execute(clip_type, solution, subject_fill_type, clip_fill_type);
+	if (!cfg.subject_open) {
+		clp.Execute(cfg.clip_type, solution, cfg.subject_fill_type, cfg.clip_fill_type);
 	} else {
 		ClipperLib::PolyTree tree;
-		clp.Execute(clip_type, tree, subject_fill_type, clip_fill_type);
+		clp.Execute(cfg.clip_type, tree, cfg.subject_fill_type, cfg.clip_fill_type);
 		ClipperLib::OpenPathsFromPolyTree(tree, solution);
 	}
-
-	Vector<Vector<Point2>> ret;
-	GodotClipperUtils::scale_down_polypaths(solution, ret);
-
-	return ret;
+	return solution;
 }
 
-void PolyBoolean2DClipper6::boolean_polypaths_tree(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op, PolyNode2D *r_root) {
+void PolyBoolean2DClipper6::boolean_polypaths_tree(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters, PolyNode2D *r_root) {
 	ERR_FAIL_NULL(r_root);
 
-	ClipperLib::Clipper clp = configure(p_op, parameters);
+	const Config cfg = configure(p_op, p_parameters);
+	ClipperLib::Clipper clp(cfg.init_options);
 
-	ClipperLib::Paths subject;
-	GodotClipperUtils::scale_up_polypaths(p_polypaths_a, subject);
-	clp.AddPaths(subject, ClipperLib::ptSubject, !subject_open);
+	ClipperScratchPaths<ClipperLib::Paths> subject(subject_buffer);
+	GodotClipperUtils::scale_up_polypaths(p_polypaths_a, subject.get());
+	clp.AddPaths(subject.get(), ClipperLib::ptSubject, !cfg.subject_open);
 
 	if (!p_polypaths_b.empty()) { // Optional for merge operation.
-		ClipperLib::Paths clip;
-		GodotClipperUtils::scale_up_polypaths(p_polypaths_b, clip);
-		clp.AddPaths(clip, ClipperLib::ptClip, true);
+		ClipperScratchPaths<ClipperLib::Paths> clip(clip_buffer);
+		GodotClipperUtils::scale_up_polypaths(p_polypaths_b, clip.get());
+		clp.AddPaths(clip.get(), ClipperLib::ptClip, true);
 	}
 
 	ClipperLib::PolyTree tree;
-	clp.Execute(clip_type, tree, subject_fill_type, clip_fill_type);
+	clp.Execute(cfg.clip_type, tree, cfg.subject_fill_type, cfg.clip_fill_type);
 
 	List<ClipperLib::PolyNode *> to_visit;
 	Map<ClipperLib::PolyNode *, PolyNode2D *> nodes;
@@ -69,36 +93,38 @@ void PolyBoolean2DClipper6::boolean_polypaths_tree(const Vector<Vector<Point2>>
 	}
 }
 
-ClipperLib::Clipper PolyBoolean2DClipper6::configure(Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters) {
+PolyBoolean2DClipper6::Config PolyBoolean2DClipper6::configure(Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters) {
 	using namespace ClipperLib;
 
+	Config cfg;
 	switch (p_op) {
 		case OP_NONE: {
 			// OP_NONE is not available in clipper6 backend, fallback to OP_UNION.
-			clip_type = ctUnion;
+			cfg.clip_type = ctUnion;
 		} break;
 		case OP_UNION:
-			clip_type = ctUnion;
+			cfg.clip_type = ctUnion;
 			break;
 		case OP_DIFFERENCE:
-			clip_type = ctDifference;
+			cfg.clip_type = ctDifference;
 			break;
 		case OP_INTERSECTION:
-			clip_type = ctIntersection;
+			cfg.clip_type = ctIntersection;
 			break;
 		case OP_XOR:
-			clip_type = ctXor;
+			cfg.clip_type = ctXor;
 			break;
 	}
 
 	int init_options = 0;
 
-	subject_fill_type = PolyFillType(p_parameters->subject_fill_rule);
-	clip_fill_type = PolyFillType(p_parameters->clip_fill_rule);
+	cfg.subject_fill_type = PolyFillType(p_parameters->subject_fill_rule);
+	cfg.clip_fill_type = PolyFillType(p_parameters->clip_fill_rule);
 	init_options |= p_parameters->reverse_solution ? InitOptions::ioReverseSolution : 0;
 	init_options |= p_parameters->strictly_simple ? InitOptions::ioStrictlySimple : 0;
 	init_options |= p_parameters->preserve_collinear ? InitOptions::ioPreserveCollinear : 0;
-	subject_open = p_parameters->subject_open;
+	cfg.init_options = init_options;
+	cfg.subject_open = p_parameters->subject_open;
 
-	return Clipper(init_options);
+	return cfg;
 }
@@ -5,14 +5,18 @@
 
 class PolyBoolean2DClipper6 : public PolyBoolean2DBackend {
 public:
-	virtual Vector<Vector<Point2>> boolean_polypaths(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op);
-	virtual void boolean_polypaths_tree(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op, PolyNode2D *r_root);
+	virtual Vector<Vector<Point2>> boolean_polypaths(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters);
+	virtual void boolean_polypaths_tree(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters, PolyNode2D *r_root);
+	virtual clipperlib::Paths boolean_paths(const clipperlib::Paths &p_paths_a, const clipperlib::Paths &p_paths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters);
 
 private:
-	ClipperLib::Clipper configure(Operation p_op, const Ref<PolyBooleanParameters2D> &p_params);
-	ClipperLib::ClipType clip_type;
-	ClipperLib::PolyFillType subject_fill_type;
-	ClipperLib::PolyFillType clip_fill_type;
-	bool subject_open;
+	struct Config {
+		ClipperLib::ClipType clip_type;
+		ClipperLib::PolyFillType subject_fill_type;
+		ClipperLib::PolyFillType clip_fill_type;
+		int init_options;
+		bool subject_open;
+	};
+	static Config configure(Operation p_op, const Ref<PolyBooleanParameters2D> &p_params);
+	static ClipperLib::Paths execute(const ClipperLib::Paths &p_subject, const ClipperLib::Paths &p_clip, Operation p_op, const Ref<PolyBooleanParameters2D> &p_params);
 };
-
@@ -1,15 +1,60 @@
 #include "poly_boolean.h"
 
+#include "goost/core/math/geometry/2d/goost_geometry_2d.h"
+#include "goost/core/math/geometry/2d/poly/poly_work_pool.h"
+
 PolyBoolean2DBackend *PolyBoolean2D::backend = nullptr;
+Ref<PolyBooleanParameters2D> PolyBoolean2D::default_parameters;
+Ref<PolyBooleanParameters2D> PolyBoolean2D::default_parameters_open;
+Mutex PolyBoolean2D::configure_mutex;
+
+void PolyBoolean2D::initialize() {
+	default_parameters.instance();
+	default_parameters_open.instance();
+	default_parameters_open->subject_open = true;
+}
+
+void PolyBoolean2D::finalize() {
+	default_parameters.unref();
+	default_parameters_open.unref();
+}
+
+clipperlib::Paths PolyBoolean2DBackend::boolean_paths(const clipperlib::Paths &p_paths_a, const clipperlib::Paths &p_paths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters) {
+	Vector<Vector<Point2>> polypaths_a;
+	PolyPaths2D::scale_down_polypaths(p_paths_a, polypaths_a);
+	Vector<Vector<Point2>> polypaths_b;
+	PolyPaths2D::scale_down_polypaths(p_paths_b, polypaths_b);
 
-void PolyBoolean2DBackend::set_parameters(const Ref<PolyBooleanParameters2D> &p_parameters) {
-	if (p_parameters.is_valid()) {
-		parameters = p_parameters;
-	} else {
-		parameters = Ref<PolyBooleanParameters2D>();
-		parameters = default_parameters;
-		parameters->reset();
+	const Vector<Vector<Point2>> &solution = boolean_polypaths(polypaths_a, polypaths_b, p_op, p_parameters);
+
+	clipperlib::Paths ret;
+	PolyPaths2D::scale_up_polypaths(solution, ret);
+	return ret;
+}
+
+Ref<PolyBooleanParameters2D> PolyBoolean2D::configure(const Ref<PolyBooleanParameters2D> &p_parameters, bool p_subject_open) {
+	if (p_parameters.is_null()) {
+		return p_subject_open ? default_parameters_open : default_parameters;
+	}
+	if (p_parameters->subject_open == p_subject_open) {
+		return p_parameters;
 	}
+	// Operations which override `subject_open` reuse the same adjusted copy,
+	// unless other parameters were changed since it was made.
+	configure_mutex.lock();
+	Ref<PolyBooleanParameters2D> params = p_parameters->configured;
+	if (params.is_null() || params->subject_open != p_subject_open ||
+			params->subject_fill_rule != p_parameters->subject_fill_rule ||
+			params->clip_fill_rule != p_parameters->clip_fill_rule ||
+			params->reverse_solution != p_parameters->reverse_solution ||
+			params->strictly_simple != p_parameters->strictly_simple ||
+			params->preserve_collinear != p_parameters->preserve_collinear) {
+		params = p_parameters->duplicate();
+		params->subject_open = p_subject_open;
+		p_parameters->configured = params;
+	}
+	configure_mutex.unlock();
+	return params;
 }
 
 void PolyBooleanParameters2D::set_subject_fill_rule(FillRule p_subject_fill_rule) {
@@ -42,52 +87,245 @@ void PolyBooleanParameters2D::set_preserve_collinear(bool p_preserve_collinear)
 	emit_changed();
 }
 
+// Computes bounding rects of all paths, empty paths are excluded from bounds.
+static bool _get_bounding_rects(const Vector<Vector<Point2>> &p_polypaths, Vector<Rect2> &r_rects, Rect2 &r_bounds) {
+	r_rects.resize(p_polypaths.size());
+	bool has_bounds = false;
+	for (int i = 0; i < p_polypaths.size(); ++i) {
+		if (p_polypaths[i].empty()) {
+			continue;
+		}
+		r_rects.write[i] = GoostGeometry2D::bounding_rect(p_polypaths[i]);
+		r_bounds = has_bounds ? r_bounds.merge(r_rects[i]) : r_rects[i];
+		has_bounds = true;
+	}
+	return has_bounds;
+}
+
+bool PolyBoolean2D::broadphase(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op,
+		Vector<Vector<Point2>> &r_polypaths_a, Vector<Vector<Point2>> &r_polypaths_b, Vector<Vector<Point2>> &r_solution) {
+	r_polypaths_a = p_polypaths_a;
+	r_polypaths_b = p_polypaths_b;
+
+	// Only difference and intersection are confined to the area of subject
+	// paths, other operations require all paths to be processed.
+	if (p_op != OP_DIFFERENCE && p_op != OP_INTERSECTION) {
+		return false;
+	}
+	// A path does not affect the winding of points outside of its bounding
+	// rect, so paths outside of the other set's bounds can be safely removed.
+	Vector<Rect2> rects_a;
+	Rect2 bounds_a;
+	if (!_get_bounding_rects(p_polypaths_a, rects_a, bounds_a)) {
+		return false;
+	}
+	Vector<Rect2> rects_b;
+	Rect2 bounds_b;
+	if (!_get_bounding_rects(p_polypaths_b, rects_b, bounds_b)) {
+		return false;
+	}
+	r_polypaths_b.clear();
+	for (int i = 0; i < p_polypaths_b.size(); ++i) {
+		if (!p_polypaths_b[i].empty() && rects_b[i].intersects(bounds_a, true)) {
+			r_polypaths_b.push_back(p_polypaths_b[i]);
+		}
+	}
+	if (p_op == OP_DIFFERENCE) {
+		// Subject paths still have to be processed even if there's nothing
+		// left to clip, so that the solution is normalized the same way.
+		return false;
+	}
+	r_polypaths_a.clear();
+	for (int i = 0; i < p_polypaths_a.size(); ++i) {
+		if (!p_polypaths_a[i].empty() && rects_a[i].intersects(bounds_b, true)) {
+			r_polypaths_a.push_back(p_polypaths_a[i]);
+		}
+	}
+	if (r_polypaths_a.empty() || r_polypaths_b.empty()) {
+		r_solution.clear();
+		return true;
+	}
+	return false;
+}
+
+Vector<Vector<Point2>> PolyBoolean2D::execute(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters) {
+	Vector<Vector<Point2>> polypaths_a;
+	Vector<Vector<Point2>> polypaths_b;
+	Vector<Vector<Point2>> solution;
+	if (broadphase(p_polypaths_a, p_polypaths_b, p_op, polypaths_a, polypaths_b, solution)) {
+		return solution;
+	}
+	return backend->boolean_polypaths(polypaths_a, polypaths_b, PolyBoolean2DBackend::Operation(p_op), p_parameters);
+}
+
 Vector<Vector<Point2>> PolyBoolean2D::merge_polygons(const Vector<Vector<Point2>> &p_polygons_a, const Vector<Vector<Point2>> &p_polygons_b, const Ref<PolyBooleanParameters2D> &p_parameters) {
-	backend->set_parameters(p_parameters);
-	backend->get_parameters()->subject_open = false;
-	return backend->boolean_polypaths(p_polygons_a, p_polygons_b, PolyBoolean2DBackend::OP_UNION);
+	Ref<PolyBooleanParameters2D> params = configure(p_parameters, false);
+	return backend->boolean_polypaths(p_polygons_a, p_polygons_b, PolyBoolean2DBackend::OP_UNION, params);
+}
+
+// Interleaves bits of cell coordinates, so that buckets which are adjacent
+// in the list are also close to each other spatially.
+static uint32_t _morton_code(uint32_t p_x, uint32_t p_y) {
+	uint32_t code = 0;
+	for (int i = 0; i < 16; ++i) {
+		code |= ((p_x >> i) & 1) << (2 * i);
+		code |= ((p_y >> i) & 1) << (2 * i + 1);
+	}
+	return code;
+}
+
+Vector<Vector<Point2>> PolyBoolean2D::merge_polygons_cascaded(const Vector<Vector<Point2>> &p_polygons, real_t p_cell_size, const Ref<PolyBooleanParameters2D> &p_parameters) {
+	// Number of polygons per bucket when the cell size is chosen automatically.
+	const int bucket_target_size = 64;
+	const int max_cells_per_axis = 256;
+
+	if (p_polygons.size() <= bucket_target_size * 2) {
+		return merge_polygons(p_polygons, Vector<Vector<Point2>>(), p_parameters);
+	}
+	// With other fill rules, polygons in different buckets would affect each
+	// other differently than they do when merged together.
+	Ref<PolyBooleanParameters2D> params = configure(p_parameters, false);
+	if (params->get_subject_fill_rule() != PolyBooleanParameters2D::FILL_RULE_NON_ZERO) {
+		return merge_polygons(p_polygons, Vector<Vector<Point2>>(), params);
+	}
+	if (params->get_clip_fill_rule() != PolyBooleanParameters2D::FILL_RULE_NON_ZERO) {
+		// Intermediate results are passed as clip polygons when merged pairwise.
+		params = params->duplicate();
+		params->set_clip_fill_rule(PolyBooleanParameters2D::FILL_RULE_NON_ZERO);
+	}
+	Vector<Rect2> rects;
+	rects.resize(p_polygons.size());
+	Rect2 bounds;
+	bool has_positive = false;
+	bool has_negative = false;
+	for (int i = 0; i < p_polygons.size(); ++i) {
+		rects.write[i] = GoostGeometry2D::bounding_rect(p_polygons[i]);
+		bounds = i == 0 ? rects[i] : bounds.merge(rects[i]);
+		const real_t area = GoostGeometry2D::polygon_area(p_polygons[i]);
+		has_positive = has_positive || area > 0.0;
+		has_negative = has_negative || area < 0.0;
+	}
+	if (has_positive && has_negative) {
+		// Overlapping polygons with opposite orientation cancel each other
+		// only if they are merged together.
+		return merge_polygons(p_polygons, Vector<Vector<Point2>>(), params);
+	}
+	real_t cell_size = p_cell_size;
+	if (cell_size <= 0.0) {
+		const real_t cells_per_axis = Math::ceil(Math::sqrt(real_t(p_polygons.size()) / bucket_target_size));
+		cell_size = MAX(bounds.size.x, bounds.size.y) / cells_per_axis;
+	}
+	if (cell_size <= CMP_EPSILON) {
+		return merge_polygons(p_polygons, Vector<Vector<Point2>>(), params);
+	}
+	const int cells_x = CLAMP(int(Math::ceil(bounds.size.x / cell_size)), 1, max_cells_per_axis);
+	const int cells_y = CLAMP(int(Math::ceil(bounds.size.y / cell_size)), 1, max_cells_per_axis);
+
+	// Polygons are assigned to cells by the center of their bounding rects.
+	Map<uint32_t, BooleanJob> buckets; // Ordered by morton code.
+	for (int i = 0; i < p_polygons.size(); ++i) {
+		const Point2 center = rects[i].position + rects[i].size * 0.5 - bounds.position;
+		const int x = CLAMP(int(center.x / cell_size), 0, cells_x - 1);
+		const int y = CLAMP(int(center.y / cell_size), 0, cells_y - 1);
+		buckets[_morton_code(x, y)].polygons_a.push_back(p_polygons[i]);
+	}
+	Vector<BooleanJob> jobs;
+	for (Map<uint32_t, BooleanJob>::Element *E = buckets.front(); E; E = E->next()) {
+		jobs.push_back(E->get());
+	}
+	buckets.clear();
+
+	Vector<Vector<Vector<Point2>>> results = boolean_polygons_batch(jobs, params);
+
+	// Merge neighboring results pairwise until there's only one left.
+	while (results.size() > 1) {
+		jobs.resize(results.size() / 2);
+		for (int i = 0; i < jobs.size(); ++i) {
+			BooleanJob &job = jobs.write[i];
+			job.polygons_a = results[i * 2];
+			job.polygons_b = results[i * 2 + 1];
+		}
+		Vector<Vector<Vector<Point2>>> merged = boolean_polygons_batch(jobs, params);
+		if (results.size() % 2 != 0) {
+			merged.push_back(results[results.size() - 1]);
+		}
+		results = merged;
+	}
+	return results.empty() ? Vector<Vector<Point2>>() : results[0];
 }
 
 Vector<Vector<Point2>> PolyBoolean2D::clip_polygons(const Vector<Vector<Point2>> &p_polygons_a, const Vector<Vector<Point2>> &p_polygons_b, const Ref<PolyBooleanParameters2D> &p_parameters) {
-	backend->set_parameters(p_parameters);
-	backend->get_parameters()->subject_open = false;
-	return backend->boolean_polypaths(p_polygons_a, p_polygons_b, PolyBoolean2DBackend::OP_DIFFERENCE);
+	Ref<PolyBooleanParameters2D> params = configure(p_parameters, false);
+	return execute(p_polygons_a, p_polygons_b, OP_DIFFERENCE, params);
 }
 
 Vector<Vector<Point2>> PolyBoolean2D::intersect_polygons(const Vector<Vector<Point2>> &p_polygons_a, const Vector<Vector<Point2>> &p_polygons_b, const Ref<PolyBooleanParameters2D> &p_parameters) {
-	backend->set_parameters(p_parameters);
-	backend->get_parameters()->subject_open = false;
-	return backend->boolean_polypaths(p_polygons_a, p_polygons_b, PolyBoolean2DBackend::OP_INTERSECTION);
+	Ref<PolyBooleanParameters2D> params = configure(p_parameters, false);
+	return execute(p_polygons_a, p_polygons_b, OP_INTERSECTION, params);
 }
 
 Vector<Vector<Point2>> PolyBoolean2D::exclude_polygons(const Vector<Vector<Point2>> &p_polygons_a, const Vector<Vector<Point2>> &p_polygons_b, const Ref<PolyBooleanParameters2D> &p_parameters) {
-	backend->set_parameters(p_parameters);
-	backend->get_parameters()->subject_open = false;
-	return backend->boolean_polypaths(p_polygons_a, p_polygons_b, PolyBoolean2DBackend::OP_XOR);
+	Ref<PolyBooleanParameters2D> params = configure(p_parameters, false);
+	return backend->boolean_polypaths(p_polygons_a, p_polygons_b, PolyBoolean2DBackend::OP_XOR, params);
 }
 
 Vector<Vector<Point2>> PolyBoolean2D::boolean_polygons(const Vector<Vector<Point2>> &p_polygons_a, const Vector<Vector<Point2>> &p_polygons_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters) {
-	backend->set_parameters(p_parameters);
-	backend->get_parameters()->subject_open = false;
-	return backend->boolean_polypaths(p_polygons_a, p_polygons_b, PolyBoolean2DBackend::Operation(p_op));
+	Ref<PolyBooleanParameters2D> params = configure(p_parameters, false);
+	return execute(p_polygons_a, p_polygons_b, p_op, params);
 }
 
 void PolyBoolean2D::boolean_polygons_tree(const Vector<Vector<Point2>> &p_polygons_a, const Vector<Vector<Point2>> &p_polygons_b, Operation p_op, PolyNode2D *r_tree, const Ref<PolyBooleanParameters2D> &p_parameters) {
-	backend->set_parameters(p_parameters);
-	backend->get_parameters()->subject_open = false;
-	backend->boolean_polypaths_tree(p_polygons_a, p_polygons_b, PolyBoolean2DBackend::Operation(p_op), r_tree);
+	Ref<PolyBooleanParameters2D> params = configure(p_parameters, false);
+	backend->boolean_polypaths_tree(p_polygons_a, p_polygons_b, PolyBoolean2DBackend::Operation(p_op), params, r_tree);
+}
+
+Ref<PolyPaths2D> PolyBoolean2D::boolean_paths(const Ref<PolyPaths2D> &p_paths_a, const Ref<PolyPaths2D> &p_paths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters) {
+	ERR_FAIL_COND_V(p_paths_a.is_null(), Ref<PolyPaths2D>());
+	Ref<PolyBooleanParameters2D> params = configure(p_parameters, false);
+
+	Ref<PolyPaths2D> ret;
+	ret.instance();
+	clipperlib::Paths empty; // Optional for merge operation.
+	const clipperlib::Paths &paths_b = p_paths_b.is_valid() ? p_paths_b->get_paths() : empty;
+	ret->get_paths() = backend->boolean_paths(p_paths_a->get_paths(), paths_b, PolyBoolean2DBackend::Operation(p_op), params);
+	return ret;
+}
+
+struct PolyBoolean2DBatch {
+	const PolyBoolean2D::BooleanJob *jobs = nullptr;
+	Vector<Vector<Point2>> *results = nullptr;
+	Ref<PolyBooleanParameters2D> parameters;
+
+	void process_job(uint32_t p_index, void *p_userdata) {
+		const PolyBoolean2D::BooleanJob &job = jobs[p_index];
+		results[p_index] = PolyBoolean2D::boolean_polygons(job.polygons_a, job.polygons_b, job.operation, parameters);
+	}
+};
+
+Vector<Vector<Vector<Point2>>> PolyBoolean2D::boolean_polygons_batch(const Vector<BooleanJob> &p_jobs, const Ref<PolyBooleanParameters2D> &p_parameters) {
+	Vector<Vector<Vector<Point2>>> ret;
+	if (p_jobs.empty()) {
+		return ret;
+	}
+	ret.resize(p_jobs.size());
+
+	PolyBoolean2DBatch batch;
+	batch.jobs = p_jobs.ptr();
+	batch.results = ret.ptrw();
+	batch.parameters = configure(p_parameters, false);
+
+	PolyWorkPool2D::do_work(p_jobs.size(), &batch, &PolyBoolean2DBatch::process_job, (void *)nullptr);
+	return ret;
 }
 
 Vector<Vector<Point2>> PolyBoolean2D::clip_polylines_with_polygons(const Vector<Vector<Point2>> &p_polylines, const Vector<Vector<Point2>> &p_polygons, const Ref<PolyBooleanParameters2D> &p_parameters) {
-	backend->set_parameters(p_parameters);
-	backend->get_parameters()->subject_open = true;
-	return backend->boolean_polypaths(p_polylines, p_polygons, PolyBoolean2DBackend::OP_DIFFERENCE);
+	Ref<PolyBooleanParameters2D> params = configure(p_parameters, true);
+	return execute(p_polylines, p_polygons, OP_DIFFERENCE, params);
 }
 
 Vector<Vector<Point2>> PolyBoolean2D::intersect_polylines_with_polygons(const Vector<Vector<Point2>> &p_polylines, const Vector<Vector<Point2>> &p_polygons, const Ref<PolyBooleanParameters2D> &p_parameters) {
-	backend->set_parameters(p_parameters);
-	backend->get_parameters()->subject_open = true;
-	return backend->boolean_polypaths(p_polylines, p_polygons, PolyBoolean2DBackend::OP_INTERSECTION);
+	Ref<PolyBooleanParameters2D> params = configure(p_parameters, true);
+	return execute(p_polylines, p_polygons, OP_INTERSECTION, params);
 }
 
 // BIND
@@ -130,6 +368,21 @@ Array _PolyBoolean2D::merge_polygons(Array p_polygons_a, Array p_polygons_b) con
 	return ret;
 }
 
+Array _PolyBoolean2D::merge_polygons_cascaded(Array p_polygons, real_t p_cell_size) const {
+	Vector<Vector<Vector2>> polygons;
+	polygons.resize(p_polygons.size());
+	for (int i = 0; i < p_polygons.size(); ++i) {
+		polygons.write[i] = p_polygons[i];
+	}
+	const auto &params = singleton == this ? Ref<PolyBooleanParameters2D>() : parameters;
+	Vector<Vector<Vector2>> solution = PolyBoolean2D::merge_polygons_cascaded(polygons, p_cell_size, params);
+	Array ret;
+	for (int i = 0; i < solution.size(); ++i) {
+		ret.push_back(solution[i]);
+	}
+	return ret;
+}
+
 Array _PolyBoolean2D::clip_polygons(Array p_polygons_a, Array p_polygons_b) const {
 	Vector<Vector<Vector2>> polygons_a;
 	for (int i = 0; i < p_polygons_a.size(); ++i) {
@@ -217,6 +470,41 @@ PolyNode2D *_PolyBoolean2D::boolean_polygons_tree(Array p_polygons_a, Array p_po
 	return root;
 }
 
+Ref<PolyPaths2D> _PolyBoolean2D::boolean_paths(const Ref<PolyPaths2D> &p_paths_a, const Ref<PolyPaths2D> &p_paths_b, Operation p_op) const {
+	const auto &params = singleton == this ? Ref<PolyBooleanParameters2D>() : parameters;
+	return PolyBoolean2D::boolean_paths(p_paths_a, p_paths_b, PolyBoolean2D::Operation(p_op), params);
+}
+
+Array _PolyBoolean2D::boolean_polygons_batch(Array p_jobs) const {
+	Vector<PolyBoolean2D::BooleanJob> jobs;
+	jobs.resize(p_jobs.size());
+	for (int i = 0; i < p_jobs.size(); ++i) {
+		Array job = p_jobs[i];
+		ERR_FAIL_COND_V_MSG(job.size() != 3, Array(), "Expected a job in the form of [polygons_a, polygons_b, operation].");
+		Array polygons_a = job[0];
+		Array polygons_b = job[1];
+		PolyBoolean2D::BooleanJob &j = jobs.write[i];
+		for (int k = 0; k < polygons_a.size(); ++k) {
+			j.polygons_a.push_back(polygons_a[k]);
+		}
+		for (int k = 0; k < polygons_b.size(); ++k) {
+			j.polygons_b.push_back(polygons_b[k]);
+		}
+		j.operation = PolyBoolean2D::Operation(int(job[2]));
+	}
+	const auto &params = singleton == this ? Ref<PolyBooleanParameters2D>() : parameters;
+	Vector<Vector<Vector<Point2>>> solutions = PolyBoolean2D::boolean_polygons_batch(jobs, params);
+	Array ret;
+	for (int i = 0; i < solutions.size(); ++i) {
+		Array solution;
+		for (int k = 0; k < solutions[i].size(); ++k) {
+			solution.push_back(solutions[i][k]);
+		}
+		ret.push_back(solution);
+	}
+	return ret;
+}
+
 Array _PolyBoolean2D::clip_polylines_with_polygons(Array p_polylines, Array p_polygons) const {
 	Vector<Vector<Point2>> polylines;
 	for (int i = 0; i < p_polylines.size(); i++) {
@@ -260,12 +548,15 @@ void _PolyBoolean2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_parameters"), &_PolyBoolean2D::get_parameters);
 
 	ClassDB::bind_method(D_METHOD("merge_polygons", "polygons_a", "polygons_b"), &_PolyBoolean2D::merge_polygons, DEFVAL(Variant()));
+	ClassDB::bind_method(D_METHOD("merge_polygons_cascaded", "polygons", "cell_size"), &_PolyBoolean2D::merge_polygons_cascaded, DEFVAL(0.0));
 	ClassDB::bind_method(D_METHOD("clip_polygons", "polygons_a", "polygons_b"), &_PolyBoolean2D::clip_polygons);
 	ClassDB::bind_method(D_METHOD("intersect_polygons", "polygons_a", "polygons_b"), &_PolyBoolean2D::intersect_polygons);
 	ClassDB::bind_method(D_METHOD("exclude_polygons", "polygons_a", "polygons_b"), &_PolyBoolean2D::exclude_polygons);
 
 	ClassDB::bind_method(D_METHOD("boolean_polygons", "polygons_a", "polygons_b", "operation"), &_PolyBoolean2D::boolean_polygons);
 	ClassDB::bind_method(D_METHOD("boolean_polygons_tree", "polygons_a", "polygons_b", "operation"), &_PolyBoolean2D::boolean_polygons_tree);
+	ClassDB::bind_method(D_METHOD("boolean_polygons_batch", "jobs"), &_PolyBoolean2D::boolean_polygons_batch);
+	ClassDB::bind_method(D_METHOD("boolean_paths", "paths_a", "paths_b", "operation"), &_PolyBoolean2D::boolean_paths);
 
 	ClassDB::bind_method(D_METHOD("clip_polylines_with_polygons", "polylines", "polygons"), &_PolyBoolean2D::clip_polylines_with_polygons);
 	ClassDB::bind_method(D_METHOD("intersect_polylines_with_polygons", "polylines", "polygons"), &_PolyBoolean2D::intersect_polylines_with_polygons);
@@ -1,16 +1,15 @@
 #pragma once
 
+#include "core/os/mutex.h"
 #include "core/resource.h"
 #include "../poly_node_2d.h"
+#include "../poly_paths_2d.h"
 
 class PolyBoolean2D;
 class PolyBooleanParameters2D;
 
 class PolyBoolean2DBackend {
 public:
-	virtual void set_parameters(const Ref<PolyBooleanParameters2D> &p_parameters);
-	virtual Ref<PolyBooleanParameters2D> get_parameters() { return parameters; }
-
 	enum Operation {
 		OP_NONE,
 		OP_UNION,
@@ -18,19 +17,14 @@ public:
 		OP_INTERSECTION,
 		OP_XOR,
 	};
-	virtual Vector<Vector<Point2>> boolean_polypaths(const Vector<Vector<Point2>> &p_polypaths_A, const Vector<Vector<Point2>> &p_polypaths_B, Operation p_op) = 0;
+	virtual Vector<Vector<Point2>> boolean_polypaths(const Vector<Vector<Point2>> &p_polypaths_A, const Vector<Vector<Point2>> &p_polypaths_B, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters) = 0;
 	// Note: `r_root` should point to an existing node.
-	virtual void boolean_polypaths_tree(const Vector<Vector<Point2>> &p_polypaths_A, const Vector<Vector<Point2>> &p_polypaths_B, Operation p_op, PolyNode2D *r_root) = 0;
+	virtual void boolean_polypaths_tree(const Vector<Vector<Point2>> &p_polypaths_A, const Vector<Vector<Point2>> &p_polypaths_B, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters, PolyNode2D *r_root) = 0;
+	// Same as `boolean_polypaths()`, but operates on fixed-point paths, see `PolyPaths2D`.
+	// Converts to floating-point coordinates and back by default.
+	virtual clipperlib::Paths boolean_paths(const clipperlib::Paths &p_paths_A, const clipperlib::Paths &p_paths_B, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters);
 
-	PolyBoolean2DBackend() {
-		default_parameters.instance();
-		parameters.instance();
-	}
 	virtual ~PolyBoolean2DBackend() {}
-
-protected:
-	Ref<PolyBooleanParameters2D> default_parameters;
-	Ref<PolyBooleanParameters2D> parameters;
 };
 
 class PolyBoolean2D {
@@ -42,13 +36,26 @@ public:
 		OP_INTERSECTION,
 		OP_XOR,
 	};
+	struct BooleanJob {
+		Vector<Vector<Point2>> polygons_a;
+		Vector<Vector<Point2>> polygons_b;
+		Operation operation = OP_UNION;
+	};
 	static Vector<Vector<Point2>> merge_polygons(const Vector<Vector<Point2>> &p_polygons_a, const Vector<Vector<Point2>> &p_polygons_b = Vector<Vector<Point2>>(), const Ref<PolyBooleanParameters2D> &p_parameters = Ref<PolyBooleanParameters2D>());
+	// Merges polygons which are close to each other first, on worker threads,
+	// then merges intermediate results pairwise. Faster than `merge_polygons()`
+	// for large sets of small polygons. If `p_cell_size` is not positive, the
+	// size of spatial buckets is determined automatically.
+	static Vector<Vector<Point2>> merge_polygons_cascaded(const Vector<Vector<Point2>> &p_polygons, real_t p_cell_size = 0.0, const Ref<PolyBooleanParameters2D> &p_parameters = Ref<PolyBooleanParameters2D>());
 	static Vector<Vector<Point2>> clip_polygons(const Vector<Vector<Point2>> &p_polygons_a, const Vector<Vector<Point2>> &p_polygons_b, const Ref<PolyBooleanParameters2D> &p_parameters = Ref<PolyBooleanParameters2D>());
 	static Vector<Vector<Point2>> intersect_polygons(const Vector<Vector<Point2>> &p_polygons_a, const Vector<Vector<Point2>> &p_polygons_b, const Ref<PolyBooleanParameters2D> &p_parameters = Ref<PolyBooleanParameters2D>());
 	static Vector<Vector<Point2>> exclude_polygons(const Vector<Vector<Point2>> &p_polygons_a, const Vector<Vector<Point2>> &p_polygons_b, const Ref<PolyBooleanParameters2D> &p_parameters = Ref<PolyBooleanParameters2D>());
 
 	static Vector<Vector<Point2>> boolean_polygons(const Vector<Vector<Point2>> &p_polygons_a, const Vector<Vector<Point2>> &p_polygons_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters = Ref<PolyBooleanParameters2D>());
 	static void boolean_polygons_tree(const Vector<Vector<Point2>> &p_polygons_a, const Vector<Vector<Point2>> &p_polygons_b, Operation p_op, PolyNode2D *r_tree, const Ref<PolyBooleanParameters2D> &p_parameters = Ref<PolyBooleanParameters2D>());
+	static Ref<PolyPaths2D> boolean_paths(const Ref<PolyPaths2D> &p_paths_a, const Ref<PolyPaths2D> &p_paths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters = Ref<PolyBooleanParameters2D>());
+	// Runs independent operations on `PolyWorkPool2D`, results are returned in the same order as jobs.
+	static Vector<Vector<Vector<Point2>>> boolean_polygons_batch(const Vector<BooleanJob> &p_jobs, const Ref<PolyBooleanParameters2D> &p_parameters = Ref<PolyBooleanParameters2D>());
 
 	static Vector<Vector<Point2>> clip_polylines_with_polygons(const Vector<Vector<Point2>> &p_polylines, const Vector<Vector<Point2>> &p_polygons, const Ref<PolyBooleanParameters2D> &p_parameters = Ref<PolyBooleanParameters2D>());
 	static Vector<Vector<Point2>> intersect_polylines_with_polygons(const Vector<Vector<Point2>> &p_polylines, const Vector<Vector<Point2>> &p_polygons, const Ref<PolyBooleanParameters2D> &p_parameters = Ref<PolyBooleanParameters2D>());
@@ -56,8 +63,23 @@ public:
 	static void set_backend(PolyBoolean2DBackend *p_backend) { backend = p_backend; }
 	static PolyBoolean2DBackend *get_backend() { return backend; }
 
+	static void initialize();
+	static void finalize();
+
 private:
 	static PolyBoolean2DBackend *backend;
+
+	static Ref<PolyBooleanParameters2D> default_parameters;
+	static Ref<PolyBooleanParameters2D> default_parameters_open;
+	static Mutex configure_mutex;
+	static Ref<PolyBooleanParameters2D> configure(const Ref<PolyBooleanParameters2D> &p_parameters, bool p_subject_open);
+
+	// Discards paths which cannot contribute to the result based on their
+	// bounding rects. Returns `true` if the solution is known without having
+	// to run the operation at all.
+	static bool broadphase(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op,
+			Vector<Vector<Point2>> &r_polypaths_a, Vector<Vector<Point2>> &r_polypaths_b, Vector<Vector<Point2>> &r_solution);
+	static Vector<Vector<Point2>> execute(const Vector<Vector<Point2>> &p_polypaths_a, const Vector<Vector<Point2>> &p_polypaths_b, Operation p_op, const Ref<PolyBooleanParameters2D> &p_parameters);
 };
 
 // BIND
@@ -87,12 +109,15 @@ public:
 		OP_XOR,
 	};
 	Array merge_polygons(Array p_polygons_a, Array p_polygons_b) const;
+	Array merge_polygons_cascaded(Array p_polygons, real_t p_cell_size) const;
 	Array clip_polygons(Array p_polygons_a, Array p_polygons_b) const;
 	Array intersect_polygons(Array p_polygons_a, Array p_polygons_b) const;
 	Array exclude_polygons(Array p_polygons_a, Array p_polygons_b) const;
 
 	Array boolean_polygons(Array p_polygons_a, Array p_polygons_b, Operation p_op) const;
 	PolyNode2D *boolean_polygons_tree(Array p_polygons_a, Array p_polygons_b, Operation p_op) const;
+	Array boolean_polygons_batch(Array p_jobs) const;
+	Ref<PolyPaths2D> boolean_paths(const Ref<PolyPaths2D> &p_paths_a, const Ref<PolyPaths2D> &p_paths_b, Operation p_op) const;
 
 	Array clip_polylines_with_polygons(Array p_polylines, Array p_polygons) const;
 	Array intersect_polylines_with_polygons(Array p_polylines, Array p_polygons) const;
@@ -113,6 +138,8 @@ VARIANT_ENUM_CAST(_PolyBoolean2D::Operation);
 class PolyBooleanParameters2D : public Resource {
 	GDCLASS(PolyBooleanParameters2D, Resource);
 
+	friend class PolyBoolean2D;
+
 public:
 	enum FillRule {
 		FILL_RULE_EVEN_ODD,
@@ -129,6 +156,10 @@ public:
 	bool strictly_simple = false;
 	bool preserve_collinear = false;
 
+private:
+	// Copy with the opposite `subject_open`, see `PolyBoolean2D::configure()`.
+	Ref<PolyBooleanParameters2D> configured;
+
 protected:
 	static void _bind_methods();
 
@@ -0,0 +1,666 @@
+#include "poly_decomp_cdt.h"
+
+#include "core/map.h"
+#include "core/set.h"
+#include "core/sort_array.h"
+#include "goost/core/math/geometry/2d/goost_geometry_2d.h"
+
+// Polygons are expected to have interior on the left of each edge, which
+// is the case for outer polygons with positive area and holes with negative
+// area. The sweep line goes from top (greater y) to bottom.
+
+enum _CDTVertexType {
+	CDT_VERTEX_START,
+	CDT_VERTEX_SPLIT,
+	CDT_VERTEX_END,
+	CDT_VERTEX_MERGE,
+	CDT_VERTEX_REGULAR,
+};
+
+static _FORCE_INLINE_ bool _cdt_above(const Point2 *p_points, int p_a, int p_b) {
+	const Point2 &a = p_points[p_a];
+	const Point2 &b = p_points[p_b];
+	if (a.y != b.y) {
+		return a.y > b.y;
+	}
+	if (a.x != b.x) {
+		return a.x < b.x;
+	}
+	return p_a < p_b;
+}
+
+static _FORCE_INLINE_ real_t _cdt_cross(const Point2 &p_a, const Point2 &p_b, const Point2 &p_c) {
+	return (p_b - p_a).cross(p_c - p_b);
+}
+
+struct _CDTAboveSort {
+	const Point2 *points = nullptr;
+
+	bool operator()(int p_a, int p_b) const {
+		return _cdt_above(points, p_a, p_b);
+	}
+};
+
+// An edge crossed by the sweep line, which has interior on the right and is
+// identified by its upper vertex. Edges never cross each other, so they can be
+// ordered from left to right by testing the upper vertex of the edge which
+// starts lower against the other edge.
+struct _CDTStatusEdge {
+	const Point2 *points = nullptr;
+	const int *next = nullptr;
+	int edge = -1;
+	int vertex = -1; // If set, this is a vertex used to look up edges instead.
+
+	_FORCE_INLINE_ bool is_left_of(int p_vertex) const {
+		return _cdt_cross(points[edge], points[next[edge]], points[p_vertex]) > 0.0;
+	}
+
+	bool operator<(const _CDTStatusEdge &p_other) const {
+		if (vertex >= 0) {
+			return !p_other.is_left_of(vertex);
+		}
+		if (p_other.vertex >= 0) {
+			return is_left_of(p_other.vertex);
+		}
+		if (edge == p_other.edge) {
+			return false;
+		}
+		if (_cdt_above(points, edge, p_other.edge)) {
+			return is_left_of(p_other.edge);
+		}
+		return !p_other.is_left_of(edge);
+	}
+};
+
+struct _CDTHalfEdge {
+	int from = 0;
+	int to = 0;
+	int twin = -1;
+	real_t angle = 0.0;
+	bool outer = false; // Reversed input edge, has exterior on the left.
+	bool visited = false;
+};
+
+struct _CDTAngleSort {
+	const _CDTHalfEdge *edges = nullptr;
+
+	bool operator()(int p_a, int p_b) const {
+		return edges[p_a].angle < edges[p_b].angle;
+	}
+};
+
+// Returns whether the point `d` lies inside of the circumcircle of the
+// counter-clockwise triangle `abc`, with some tolerance for cocircular points.
+static bool _cdt_in_circle(const Point2 &p_a, const Point2 &p_b, const Point2 &p_c, const Point2 &p_d) {
+	const double adx = double(p_a.x) - p_d.x;
+	const double ady = double(p_a.y) - p_d.y;
+	const double bdx = double(p_b.x) - p_d.x;
+	const double bdy = double(p_b.y) - p_d.y;
+	const double cdx = double(p_c.x) - p_d.x;
+	const double cdy = double(p_c.y) - p_d.y;
+
+	const double alift = adx * adx + ady * ady;
+	const double blift = bdx * bdx + bdy * bdy;
+	const double clift = cdx * cdx + cdy * cdy;
+
+	const double det = alift * (bdx * cdy - cdx * bdy) + blift * (cdx * ady - adx * cdy) + clift * (adx * bdy - bdx * ady);
+	const double permanent = alift * (Math::abs(bdx * cdy) + Math::abs(cdx * bdy)) +
+			blift * (Math::abs(cdx * ady) + Math::abs(adx * cdy)) +
+			clift * (Math::abs(adx * bdy) + Math::abs(bdx * ady));
+
+	return det > permanent * 1e-9;
+}
+
+class _CDTTriangulator {
+	Vector<Point2> points;
+	Vector<int> prev;
+	Vector<int> next;
+	real_t area = 0.0;
+
+	Vector<int> diagonals; // Pairs of vertices.
+	Vector<int> triangles; // Triples of vertices, counter-clockwise.
+
+	bool _make_monotone();
+	bool _triangulate_face(const Vector<int> &p_face);
+	bool _triangulate_monotone();
+	void _add_triangle(int p_a, int p_b, int p_c);
+	void _make_delaunay();
+
+public:
+	bool add_polygon(const Vector<Point2> &p_polygon);
+	bool triangulate();
+	void get_triangles(Vector<Vector<Point2>> &r_triangles) const;
+};
+
+bool _CDTTriangulator::add_polygon(const Vector<Point2> &p_polygon) {
+	// Consecutive duplicate points do not define any edge.
+	Vector<Point2> polygon;
+	for (int i = 0; i < p_polygon.size(); ++i) {
+		if (polygon.empty() || polygon[polygon.size() - 1] != p_polygon[i]) {
+			polygon.push_back(p_polygon[i]);
+		}
+	}
+	while (polygon.size() > 1 && polygon[0] == polygon[polygon.size() - 1]) {
+		polygon.resize(polygon.size() - 1);
+	}
+	if (polygon.size() < 3) {
+		return false;
+	}
+	const real_t polygon_area = GoostGeometry2D::polygon_area(polygon);
+	if (polygon_area == 0.0) {
+		return false;
+	}
+	area += polygon_area;
+
+	const int base = points.size();
+	const int count = polygon.size();
+	for (int i = 0; i < count; ++i) {
+		points.push_back(polygon[i]);
+		prev.push_back(base + (i + count - 1) % count);
+		next.push_back(base + (i + 1) % count);
+	}
+	return polygon_area > 0.0;
+}
+
+bool _CDTTriangulator::_make_monotone() {
+	const int n = points.size();
+	const Point2 *pts = points.ptr();
+	const int *pv = prev.ptr();
+	const int *nx = next.ptr();
+
+	Vector<int> order;
+	order.resize(n);
+	for (int i = 0; i < n; ++i) {
+		order.write[i] = i;
+	}
+	SortArray<int, _CDTAboveSort> sorter;
+	sorter.compare.points = pts;
+	sorter.sort(order.ptrw(), n);
+
+	Vector<_CDTVertexType> types;
+	types.resize(n);
+	for (int v = 0; v < n; ++v) {
+		const bool prev_below = _cdt_above(pts, v, pv[v]);
+		const bool next_below = _cdt_above(pts, v, nx[v]);
+		const bool convex = _cdt_cross(pts[pv[v]], pts[v], pts[nx[v]]) > 0.0;
+		if (prev_below && next_below) {
+			types.write[v] = convex ? CDT_VERTEX_START : CDT_VERTEX_SPLIT;
+		} else if (!prev_below && !next_below) {
+			types.write[v] = convex ? CDT_VERTEX_END : CDT_VERTEX_MERGE;
+		} else {
+			types.write[v] = CDT_VERTEX_REGULAR;
+		}
+	}
+	// Edges crossed by the sweep line, ordered from left to right.
+	Set<_CDTStatusEdge> status;
+	Vector<Set<_CDTStatusEdge>::Element *> status_elements;
+	status_elements.resize(n);
+	for (int i = 0; i < n; ++i) {
+		status_elements.write[i] = nullptr;
+	}
+	Vector<int> helper;
+	helper.resize(n);
+
+	_CDTStatusEdge key;
+	key.points = pts;
+	key.next = nx;
+
+	// Returns the closest edge to the left of the vertex, or -1 if none.
+	auto find_left = [&](int p_vertex) -> int {
+		_CDTStatusEdge query = key;
+		query.vertex = p_vertex;
+		Set<_CDTStatusEdge>::Element *E = status.lower_bound(query);
+		E = E ? E->prev() : status.back();
+		return E ? E->get().edge : -1;
+	};
+	auto insert_edge = [&](int p_edge) {
+		_CDTStatusEdge se = key;
+		se.edge = p_edge;
+		status_elements.write[p_edge] = status.insert(se);
+		helper.write[p_edge] = p_edge;
+	};
+	auto remove_edge = [&](int p_edge) -> bool {
+		Set<_CDTStatusEdge>::Element *E = status_elements[p_edge];
+		if (!E) {
+			return false;
+		}
+		status.erase(E);
+		status_elements.write[p_edge] = nullptr;
+		return true;
+	};
+	auto add_diagonal_to_merge_helper = [&](int p_vertex, int p_edge) {
+		if (types[helper[p_edge]] == CDT_VERTEX_MERGE) {
+			diagonals.push_back(p_vertex);
+			diagonals.push_back(helper[p_edge]);
+		}
+	};
+
+	for (int i = 0; i < n; ++i) {
+		const int v = order[i];
+		switch (types[v]) {
+			case CDT_VERTEX_START: {
+				insert_edge(v);
+			} break;
+			case CDT_VERTEX_END: {
+				add_diagonal_to_merge_helper(v, pv[v]);
+				if (!remove_edge(pv[v])) {
+					return false;
+				}
+			} break;
+			case CDT_VERTEX_SPLIT: {
+				const int e = find_left(v);
+				if (e < 0) {
+					return false;
+				}
+				diagonals.push_back(v);
+				diagonals.push_back(helper[e]);
+				helper.write[e] = v;
+				insert_edge(v);
+			} break;
+			case CDT_VERTEX_MERGE: {
+				add_diagonal_to_merge_helper(v, pv[v]);
+				if (!remove_edge(pv[v])) {
+					return false;
+				}
+				const int e = find_left(v);
+				if (e < 0) {
+					return false;
+				}
+				add_diagonal_to_merge_helper(v, e);
+				helper.write[e] = v;
+			} break;
+			case CDT_VERTEX_REGULAR: {
+				if (_cdt_above(pts, pv[v], v)) { // Interior is on the right.
+					add_diagonal_to_merge_helper(v, pv[v]);
+					if (!remove_edge(pv[v])) {
+						return false;
+					}
+					insert_edge(v);
+				} else {
+					const int e = find_left(v);
+					if (e < 0) {
+						return false;
+					}
+					add_diagonal_to_merge_helper(v, e);
+					helper.write[e] = v;
+				}
+			} break;
+		}
+	}
+	return true;
+}
+
+void _CDTTriangulator::_add_triangle(int p_a, int p_b, int p_c) {
+	const real_t cross = _cdt_cross(points[p_a], points[p_b], points[p_c]);
+	if (cross == 0.0) {
+		return; // Degenerate.
+	}
+	triangles.push_back(p_a);
+	if (cross > 0.0) {
+		triangles.push_back(p_b);
+		triangles.push_back(p_c);
+	} else {
+		triangles.push_back(p_c);
+		triangles.push_back(p_b);
+	}
+}
+
+bool _CDTTriangulator::_triangulate_face(const Vector<int> &p_face) {
+	const int count = p_face.size();
+	const Point2 *pts = points.ptr();
+	if (count < 3) {
+		return false;
+	}
+	if (count == 3) {
+		_add_triangle(p_face[0], p_face[1], p_face[2]);
+		return true;
+	}
+	int top = 0;
+	int bottom = 0;
+	for (int i = 1; i < count; ++i) {
+		if (_cdt_above(pts, p_face[i], p_face[top])) {
+			top = i;
+		}
+		if (_cdt_above(pts, p_face[bottom], p_face[i])) {
+			bottom = i;
+		}
+	}
+	// Going counter-clockwise from the top leads along the left chain,
+	// merge both chains into a sequence ordered from top to bottom.
+	Vector<int> sorted;
+	Vector<bool> left_chain;
+	sorted.resize(count);
+	left_chain.resize(count);
+	int l = (top + 1) % count;
+	int r = (top + count - 1) % count;
+	sorted.write[0] = p_face[top];
+	left_chain.write[0] = true;
+	for (int i = 1; i < count; ++i) {
+		if (l != bottom && (r == bottom || _cdt_above(pts, p_face[l], p_face[r]))) {
+			sorted.write[i] = p_face[l];
+			left_chain.write[i] = true;
+			l = (l + 1) % count;
+		} else {
+			sorted.write[i] = p_face[r];
+			left_chain.write[i] = false;
+			r = (r + count - 1) % count;
+		}
+		if (l == bottom && r == bottom) {
+			if (i != count - 2) {
+				return false; // Not monotone.
+			}
+			sorted.write[count - 1] = p_face[bottom];
+			left_chain.write[count - 1] = true;
+			break;
+		}
+	}
+	Vector<int> stack; // Indices in `sorted`.
+	stack.push_back(0);
+	stack.push_back(1);
+	for (int j = 2; j < count - 1; ++j) {
+		const int top_idx = stack[stack.size() - 1];
+		if (left_chain[j] != left_chain[top_idx]) {
+			for (int k = 0; k < stack.size() - 1; ++k) {
+				_add_triangle(sorted[j], sorted[stack[k]], sorted[stack[k + 1]]);
+			}
+			stack.clear();
+			stack.push_back(j - 1);
+			stack.push_back(j);
+		} else {
+			int last = stack[stack.size() - 1];
+			stack.resize(stack.size() - 1);
+			while (!stack.empty()) {
+				const int s = stack[stack.size() - 1];
+				const Point2 &a = pts[sorted[s]];
+				const Point2 &b = pts[sorted[last]];
+				const Point2 &c = pts[sorted[j]];
+				const bool inside = left_chain[j] ? _cdt_cross(a, b, c) > 0.0 : _cdt_cross(c, b, a) > 0.0;
+				if (!inside) {
+					break;
+				}
+				_add_triangle(sorted[s], sorted[last], sorted[j]);
+				last = s;
+				stack.resize(stack.size() - 1);
+			}
+			stack.push_back(last);
+			stack.push_back(j);
+		}
+	}
+	for (int k = 0; k < stack.size() - 1; ++k) {
+		_add_triangle(sorted[count - 1], sorted[stack[k]], sorted[stack[k + 1]]);
+	}
+	return true;
+}
+
+bool _CDTTriangulator::_triangulate_monotone() {
+	const int n = points.size();
+	const int diagonal_count = diagonals.size() / 2;
+
+	// Half-edges of input edges and diagonals, the faces on the left of
+	// which form monotone polygons.
+	Vector<_CDTHalfEdge> edges;
+	edges.resize(n * 2 + diagonal_count * 2);
+	_CDTHalfEdge *he = edges.ptrw();
+	for (int v = 0; v < n; ++v) {
+		he[v].from = v;
+		he[v].to = next[v];
+		he[v].twin = n + next[v];
+		he[n + v].from = v;
+		he[n + v].to = prev[v];
+		he[n + v].twin = prev[v];
+		he[n + v].outer = true;
+	}
+	for (int i = 0; i < diagonal_count; ++i) {
+		const int a = n * 2 + i * 2;
+		he[a].from = diagonals[i * 2];
+		he[a].to = diagonals[i * 2 + 1];
+		he[a].twin = a + 1;
+		he[a + 1].from = diagonals[i * 2 + 1];
+		he[a + 1].to = diagonals[i * 2];
+		he[a + 1].twin = a;
+	}
+	// Outgoing half-edges around each vertex, sorted counter-clockwise.
+	Vector<int> offsets;
+	offsets.resize(n + 1);
+	int *ofs = offsets.ptrw();
+	for (int i = 0; i <= n; ++i) {
+		ofs[i] = 0;
+	}
+	for (int i = 0; i < edges.size(); ++i) {
+		const Vector2 dir = points[he[i].to] - points[he[i].from];
+		he[i].angle = Math::atan2(dir.y, dir.x);
+		ofs[he[i].from + 1]++;
+	}
+	for (int i = 0; i < n; ++i) {
+		ofs[i + 1] += ofs[i];
+	}
+	Vector<int> outgoing;
+	outgoing.resize(edges.size());
+	Vector<int> position; // Of each half-edge in `outgoing`.
+	position.resize(edges.size());
+	{
+		Vector<int> fill;
+		fill.resize(n);
+		int *f = fill.ptrw();
+		for (int i = 0; i < n; ++i) {
+			f[i] = ofs[i];
+		}
+		for (int i = 0; i < edges.size(); ++i) {
+			outgoing.write[f[he[i].from]++] = i;
+		}
+		SortArray<int, _CDTAngleSort> sorter;
+		sorter.compare.edges = he;
+		for (int v = 0; v < n; ++v) {
+			sorter.sort_range(ofs[v], ofs[v + 1], outgoing.ptrw());
+		}
+		for (int i = 0; i < outgoing.size(); ++i) {
+			position.write[outgoing[i]] = i;
+		}
+	}
+	Vector<int> face;
+	for (int i = 0; i < edges.size(); ++i) {
+		if (he[i].outer || he[i].visited) {
+			continue;
+		}
+		face.clear();
+		int e = i;
+		int steps = 0;
+		do {
+			if (he[e].outer || steps++ > edges.size()) {
+				return false; // Invalid topology.
+			}
+			he[e].visited = true;
+			face.push_back(he[e].from);
+			// The next edge is the one following the twin clockwise.
+			const int v = he[e].to;
+			const int p = position[he[e].twin];
+			e = outgoing[p > ofs[v] ? p - 1 : ofs[v + 1] - 1];
+		} while (e != i);
+
+		if (!_triangulate_face(face)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void _CDTTriangulator::_make_delaunay() {
+	const int tri_count = triangles.size() / 3;
+	int *tris = triangles.ptrw();
+	const Point2 *pts = points.ptr();
+
+	// Neighbor across the edge starting at each corner of the triangle.
+	Vector<int> adjacent;
+	adjacent.resize(triangles.size());
+	int *adj = adjacent.ptrw();
+	Map<uint64_t, int> edge_map;
+	for (int t = 0; t < tri_count; ++t) {
+		for (int k = 0; k < 3; ++k) {
+			adj[t * 3 + k] = -1;
+			const uint32_t a = tris[t * 3 + k];
+			const uint32_t b = tris[t * 3 + (k + 1) % 3];
+			if (next[a] == int(b) || next[b] == int(a)) {
+				continue; // Input edges are constrained, so never linked.
+			}
+			const uint64_t key = (uint64_t(MIN(a, b)) << 32) | MAX(a, b);
+			Map<uint64_t, int>::Element *E = edge_map.find(key);
+			if (E) {
+				adj[t * 3 + k] = E->get() / 3;
+				adj[E->get()] = t;
+			} else {
+				edge_map.insert(key, t * 3 + k);
+			}
+		}
+	}
+	auto corner_of = [&](int p_tri, int p_neighbor) -> int {
+		for (int k = 0; k < 3; ++k) {
+			if (adj[p_tri * 3 + k] == p_neighbor) {
+				return k;
+			}
+		}
+		return -1;
+	};
+	Vector<int> stack; // Pairs of triangle and corner.
+	for (int t = 0; t < tri_count; ++t) {
+		for (int k = 0; k < 3; ++k) {
+			if (adj[t * 3 + k] > t) {
+				stack.push_back(t);
+				stack.push_back(k);
+			}
+		}
+	}
+	// Flipping terminates in exact arithmetic, but may take O(n^2) flips in
+	// the worst case. Limited to keep the time bounded for such input, and
+	// in case rounding errors lead to flipping the same edges back and forth.
+	int flips_left = tri_count * 64;
+
+	while (!stack.empty() && flips_left > 0) {
+		const int k = stack[stack.size() - 1];
+		const int t = stack[stack.size() - 2];
+		stack.resize(stack.size() - 2);
+
+		const int u = adj[t * 3 + k];
+		if (u < 0) {
+			continue; // Constrained.
+		}
+		const int a = tris[t * 3 + k];
+		const int b = tris[t * 3 + (k + 1) % 3];
+		const int c = tris[t * 3 + (k + 2) % 3];
+		const int kk = corner_of(u, t);
+		ERR_CONTINUE(kk < 0);
+		const int d = tris[u * 3 + (kk + 2) % 3];
+
+		if (!_cdt_in_circle(pts[a], pts[b], pts[c], pts[d])) {
+			continue;
+		}
+		const int n_bc = adj[t * 3 + (k + 1) % 3];
+		const int n_ca = adj[t * 3 + (k + 2) % 3];
+		const int n_ad = adj[u * 3 + (kk + 1) % 3];
+		const int n_db = adj[u * 3 + (kk + 2) % 3];
+		const int corner_ad = n_ad >= 0 ? corner_of(n_ad, u) : -1;
+		const int corner_bc = n_bc >= 0 ? corner_of(n_bc, t) : -1;
+		ERR_CONTINUE(n_ad >= 0 && corner_ad < 0);
+		ERR_CONTINUE(n_bc >= 0 && corner_bc < 0);
+
+		// Replace (a, b, c) and (b, a, d) with (a, d, c) and (d, b, c).
+		tris[t * 3 + 0] = a;
+		tris[t * 3 + 1] = d;
+		tris[t * 3 + 2] = c;
+		adj[t * 3 + 0] = n_ad;
+		adj[t * 3 + 1] = u;
+		adj[t * 3 + 2] = n_ca;
+
+		tris[u * 3 + 0] = d;
+		tris[u * 3 + 1] = b;
+		tris[u * 3 + 2] = c;
+		adj[u * 3 + 0] = n_db;
+		adj[u * 3 + 1] = n_bc;
+		adj[u * 3 + 2] = t;
+
+		if (n_ad >= 0) {
+			adj[n_ad * 3 + corner_ad] = t;
+		}
+		if (n_bc >= 0) {
+			adj[n_bc * 3 + corner_bc] = u;
+		}
+		stack.push_back(t);
+		stack.push_back(0);
+		stack.push_back(t);
+		stack.push_back(2);
+		stack.push_back(u);
+		stack.push_back(0);
+		stack.push_back(u);
+		stack.push_back(1);
+		--flips_left;
+	}
+	if (flips_left <= 0 && !stack.empty()) {
+		WARN_PRINT_ONCE("Reached the limit of edge flips, some triangles may not be Delaunay.");
+	}
+}
+
+bool _CDTTriangulator::triangulate() {
+	if (points.empty()) {
+		return true;
+	}
+	if (!_make_monotone()) {
+		return false;
+	}
+	if (!_triangulate_monotone()) {
+		return false;
+	}
+	// Self-intersecting polygons cannot be partitioned correctly, which
+	// is mostly detected by the mismatching area of triangles.
+	real_t tri_area = 0.0;
+	for (int i = 0; i < triangles.size(); i += 3) {
+		tri_area += _cdt_cross(points[triangles[i]], points[triangles[i + 1]], points[triangles[i + 2]]) * 0.5;
+	}
+	if (Math::abs(tri_area - area) > Math::abs(area) * 1e-3) {
+		return false;
+	}
+	_make_delaunay();
+	return true;
+}
+
+void _CDTTriangulator::get_triangles(Vector<Vector<Point2>> &r_triangles) const {
+	r_triangles.resize(triangles.size() / 3);
+	for (int i = 0; i < r_triangles.size(); ++i) {
+		Vector<Point2> &tri = r_triangles.write[i];
+		tri.resize(3);
+		tri.write[0] = points[triangles[i * 3 + 0]];
+		tri.write[1] = points[triangles[i * 3 + 1]];
+		tri.write[2] = points[triangles[i * 3 + 2]];
+	}
+}
+
+bool PolyDecomp2DCDT::triangulate(const Vector<Vector<Point2>> &p_polygons, Vector<Vector<Point2>> &r_triangles) {
+	_CDTTriangulator cdt;
+	bool has_outer = false;
+	for (int i = 0; i < p_polygons.size(); ++i) {
+		has_outer = cdt.add_polygon(p_polygons[i]) || has_outer;
+	}
+	if (!has_outer) {
+		return false;
+	}
+	if (!cdt.triangulate()) {
+		return false;
+	}
+	cdt.get_triangles(r_triangles);
+	return true;
+}
+
+Vector<Vector<Point2>> PolyDecomp2DCDT::triangulate_ec(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters) {
+	Vector<Vector<Point2>> triangles;
+	if (!triangulate(p_polygons, triangles)) {
+		// Inputs which cannot be handled are left to polypartition.
+		return PolyDecomp2DPolyPartition::triangulate_ec(p_polygons, p_parameters);
+	}
+	return triangles;
+}
+
+Vector<Vector<Point2>> PolyDecomp2DCDT::triangulate_mono(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters) {
+	Vector<Vector<Point2>> triangles;
+	if (!triangulate(p_polygons, triangles)) {
+		return PolyDecomp2DPolyPartition::triangulate_mono(p_polygons, p_parameters);
+	}
+	return triangles;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "../polypartition/poly_decomp_polypartition.h"
+
+class PolyDecompParameters2D;
+
+// Constrained Delaunay triangulation. Polygons are partitioned into monotone
+// pieces with a sweep line, each piece is triangulated in linear time, and
+// triangles are then made Delaunay with edge flips, keeping input edges.
+// The number of flips is limited to 64 per triangle, so the result may not be
+// Delaunay for unusual input. Polygons are filled according to orientation,
+// `PolyDecompParameters2D::fill_rule` is ignored. Other decompositions are
+// performed by polypartition.
+class PolyDecomp2DCDT : public PolyDecomp2DPolyPartition {
+public:
+	virtual Vector<Vector<Point2>> triangulate_ec(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters);
+	virtual Vector<Vector<Point2>> triangulate_mono(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters);
+
+private:
+	static bool triangulate(const Vector<Vector<Point2>> &p_polygons, Vector<Vector<Point2>> &r_triangles);
+};
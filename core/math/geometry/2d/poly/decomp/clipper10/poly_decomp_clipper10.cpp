@@ -1,17 +1,25 @@
 #include "poly_decomp_clipper10.h"
+#include "goost/core/math/geometry/2d/poly/utils/clipper_scratch_paths.h"
 #include "goost/core/math/geometry/2d/poly/utils/godot_clipper10_path_convert.h"
 
-Vector<Vector<Point2>> PolyDecomp2DClipper10::triangulate_mono(const Vector<Vector<Point2>> &p_polygons) {
-	using namespace clipperlib;
+static thread_local clipperlib::Paths subject_buffer;
 
-	ClipperTri clp = configure(parameters);
+Vector<Vector<Point2>> PolyDecomp2DClipper10::triangulate_mono(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters) {
+	ClipperScratchPaths<clipperlib::Paths> subject(subject_buffer);
+	GodotClipperUtils::scale_up_polypaths(p_polygons, subject.get());
+	const clipperlib::Paths triangles = triangulate(subject.get(), p_parameters);
 
-	Paths subject;
-	GodotClipperUtils::scale_up_polypaths(p_polygons, subject);
-	clp.AddPaths(subject, ptSubject);
+	Vector<Vector<Point2>> ret;
+	GodotClipperUtils::scale_down_polypaths(triangles, ret);
 
-	Paths triangles;
-	clp.Execute(ctUnion, triangles, fill_rule);
+	return ret;
+}
+
+Vector<Vector<Point2>> PolyDecomp2DClipper10::decompose_paths(const clipperlib::Paths &p_paths, Decomposition p_type, const Ref<PolyDecompParameters2D> &p_parameters) {
+	if (p_type != DECOMP_TRIANGLES_MONO) {
+		return PolyDecomp2DPolyPartition::decompose_paths(p_paths, p_type, p_parameters);
+	}
+	const clipperlib::Paths triangles = triangulate(p_paths, p_parameters);
 
 	Vector<Vector<Point2>> ret;
 	GodotClipperUtils::scale_down_polypaths(triangles, ret);
@@ -19,10 +27,14 @@ Vector<Vector<Point2>> PolyDecomp2DClipper10::triangulate_mono(const Vector<Vect
 	return ret;
 }
 
-clipperlib::ClipperTri PolyDecomp2DClipper10::configure(const Ref<PolyDecompParameters2D> &p_parameters) {
+clipperlib::Paths PolyDecomp2DClipper10::triangulate(const clipperlib::Paths &p_paths, const Ref<PolyDecompParameters2D> &p_parameters) {
 	using namespace clipperlib;
 
-	fill_rule = FillRule(p_parameters->fill_rule);
+	ClipperTri clp;
+	clp.AddPaths(p_paths, ptSubject);
+
+	Paths triangles;
+	clp.Execute(ctUnion, triangles, FillRule(p_parameters->fill_rule));
 
-	return ClipperTri();
+	return triangles;
 }
@@ -5,10 +5,9 @@
 
 class PolyDecomp2DClipper10 : public PolyDecomp2DPolyPartition {
 public:
-	virtual Vector<Vector<Point2>> triangulate_mono(const Vector<Vector<Point2>> &p_polygons);
+	virtual Vector<Vector<Point2>> triangulate_mono(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters);
+	virtual Vector<Vector<Point2>> decompose_paths(const clipperlib::Paths &p_paths, Decomposition p_type, const Ref<PolyDecompParameters2D> &p_parameters);
 
 private:
-	clipperlib::ClipperTri configure(const Ref<PolyDecompParameters2D> &p_params);
-	clipperlib::FillRule fill_rule;
+	static clipperlib::Paths triangulate(const clipperlib::Paths &p_paths, const Ref<PolyDecompParameters2D> &p_parameters);
 };
-
@@ -1,57 +1,459 @@
 #include "poly_decomp.h"
 
+#include "core/map.h"
+#include "core/math/geometry.h"
+#include "core/os/os.h"
+#include "core/set.h"
+#include "core/sort_array.h"
+#include "goost/core/math/geometry/2d/goost_geometry_2d.h"
+#include "goost/core/math/geometry/2d/poly/poly_backends.h"
+#include "goost/core/math/geometry/2d/poly/poly_work_pool.h"
+
+// Minimum number of points for decomposing independent polygons in parallel.
+static const int PARALLEL_MIN_POINTS = 1024;
+
+struct _PolyDecomp2DRectSort {
+	const Rect2 *rects = nullptr;
+
+	bool operator()(int p_a, int p_b) const {
+		return rects[p_a].position.x < rects[p_b].position.x;
+	}
+};
+
 PolyDecomp2DBackend *PolyDecomp2D::backend = nullptr;
+Ref<PolyDecompParameters2D> PolyDecomp2D::default_parameters;
+
+void PolyDecomp2D::initialize() {
+	default_parameters.instance();
+}
+
+void PolyDecomp2D::finalize() {
+	default_parameters.unref();
+}
+
+Ref<PolyDecompParameters2D> PolyDecomp2D::configure(const Ref<PolyDecompParameters2D> &p_parameters) {
+	if (p_parameters.is_null()) {
+		return default_parameters;
+	}
+	return p_parameters;
+}
+
+// Splits polygons into groups with overlapping bounding rectangles, so that
+// holes end up in the same group as their outer polygons, and groups can be
+// decomposed independently. Groups are ordered by their first polygon.
+static Vector<Vector<Vector<Point2>>> _group_polygons(const Vector<Vector<Point2>> &p_polygons) {
+	const int count = p_polygons.size();
+
+	Vector<Rect2> rects;
+	rects.resize(count);
+	Vector<int> order;
+	order.resize(count);
+	Vector<int> parents; // Disjoint sets.
+	parents.resize(count);
+	int *parent = parents.ptrw();
+	for (int i = 0; i < count; ++i) {
+		rects.write[i] = GoostGeometry2D::bounding_rect(p_polygons[i]);
+		order.write[i] = i;
+		parent[i] = i;
+	}
+	auto find = [&](int p_idx) -> int {
+		while (parent[p_idx] != p_idx) {
+			parent[p_idx] = parent[parent[p_idx]];
+			p_idx = parent[p_idx];
+		}
+		return p_idx;
+	};
+	SortArray<int, _PolyDecomp2DRectSort> sorter;
+	sorter.compare.rects = rects.ptr();
+	sorter.sort(order.ptrw(), count);
+
+	// Sweep along the x axis, only rectangles crossing the sweep line can overlap.
+	Vector<int> active;
+	for (int i = 0; i < count; ++i) {
+		const int idx = order[i];
+		const Rect2 &rect = rects[idx];
+		for (int j = active.size() - 1; j >= 0; --j) {
+			const Rect2 &other = rects[active[j]];
+			if (other.position.x + other.size.x < rect.position.x) {
+				active.remove(j);
+				continue;
+			}
+			if (other.position.y <= rect.position.y + rect.size.y && rect.position.y <= other.position.y + other.size.y) {
+				const int a = find(idx);
+				const int b = find(active[j]);
+				parent[MAX(a, b)] = MIN(a, b);
+			}
+		}
+		active.push_back(idx);
+	}
+	// Roots are the smallest indices in each set.
+	Vector<Vector<Vector<Point2>>> groups;
+	Vector<int> group_of;
+	group_of.resize(count);
+	for (int i = 0; i < count; ++i) {
+		const int root = find(i);
+		if (root == i) {
+			group_of.write[i] = groups.size();
+			groups.push_back(Vector<Vector<Point2>>());
+		}
+		groups.write[group_of[root]].push_back(p_polygons[i]);
+	}
+	return groups;
+}
+
+struct PolyDecomp2DBatch {
+	PolyDecomp2DBackend *backend = nullptr;
+	PolyDecomp2DBackend::Decomposition type = PolyDecomp2DBackend::DECOMP_TRIANGLES_MONO;
+	const Vector<Vector<Point2>> *groups = nullptr;
+	Vector<Vector<Point2>> *results = nullptr;
+	Ref<PolyDecompParameters2D> parameters;
+
+	void process_group(uint32_t p_index, void *p_userdata) {
+		results[p_index] = backend->_decompose(groups[p_index], type, parameters);
+	}
+};
+
+Vector<Vector<Point2>> PolyDecomp2DBackend::decompose_polygons(const Vector<Vector<Point2>> &p_polygons, Decomposition p_type, const Ref<PolyDecompParameters2D> &p_parameters) {
+	int point_count = 0;
+	for (int i = 0; i < p_polygons.size(); ++i) {
+		point_count += p_polygons[i].size();
+	}
+	const int threads_count = OS::get_singleton()->get_processor_count();
+	if (threads_count <= 1 || p_polygons.size() < 2 || point_count < PARALLEL_MIN_POINTS) {
+		return _decompose(p_polygons, p_type, p_parameters); // Not worth the overhead.
+	}
+	if (p_type == DECOMP_CONVEX_APPROX && p_parameters->get_max_pieces() > 0) {
+		// The number of pieces is limited for all polygons at once.
+		return _decompose(p_polygons, p_type, p_parameters);
+	}
+	const Vector<Vector<Vector<Point2>>> &groups = _group_polygons(p_polygons);
+	if (groups.size() < 2) {
+		return _decompose(p_polygons, p_type, p_parameters);
+	}
+	Vector<Vector<Vector<Point2>>> results;
+	results.resize(groups.size());
+
+	PolyDecomp2DBatch batch;
+	batch.backend = this;
+	batch.type = p_type;
+	batch.groups = groups.ptr();
+	batch.results = results.ptrw();
+	batch.parameters = p_parameters;
+
+	PolyWorkPool2D::do_work(groups.size(), &batch, &PolyDecomp2DBatch::process_group, (void *)nullptr);
 
-void PolyDecomp2DBackend::set_parameters(const Ref<PolyDecompParameters2D> &p_parameters) {
-	if (p_parameters.is_valid()) {
-		parameters = p_parameters;
-	} else {
-		parameters = Ref<PolyDecompParameters2D>();
-		parameters = default_parameters;
-		parameters->reset();
+	Vector<Vector<Point2>> ret;
+	for (int i = 0; i < results.size(); ++i) {
+		ret.append_array(results[i]);
 	}
+	return ret;
 }
 
-Vector<Vector<Point2>> PolyDecomp2DBackend::decompose_polygons(const Vector<Vector<Point2>> &p_polygons, Decomposition p_type) {
+Vector<Vector<Point2>> PolyDecomp2DBackend::_decompose(const Vector<Vector<Point2>> &p_polygons, Decomposition p_type, const Ref<PolyDecompParameters2D> &p_parameters) {
 	Vector<Vector<Point2>> polys;
 	switch (p_type) {
 		case DECOMP_TRIANGLES_EC: {
-			polys = triangulate_ec(p_polygons);
+			polys = triangulate_ec(p_polygons, p_parameters);
 		} break;
 		case DECOMP_TRIANGLES_OPT: {
-			polys = triangulate_opt(p_polygons);
+			polys = triangulate_opt(p_polygons, p_parameters);
 		} break;
 		case DECOMP_TRIANGLES_MONO: {
-			polys = triangulate_mono(p_polygons);
+			polys = triangulate_mono(p_polygons, p_parameters);
 		} break;
 		case DECOMP_CONVEX_HM: {
-			polys = decompose_convex_hm(p_polygons);
+			polys = decompose_convex_hm(p_polygons, p_parameters);
 		} break;
 		case DECOMP_CONVEX_OPT: {
-			polys = decompose_convex_opt(p_polygons);
+			polys = decompose_convex_opt(p_polygons, p_parameters);
+		} break;
+		case DECOMP_CONVEX_APPROX: {
+			polys = decompose_convex_approx(p_polygons, p_parameters);
 		} break;
 	}
 	return polys;
 }
 
+struct _ConvexPiece {
+	Vector<Point2> points; // Vertices of all merged pieces, lie on the boundary of the input.
+	Vector<Point2> hull;
+	Rect2 rect; // Of the hull.
+	Set<int> neighbors;
+	bool merged = false;
+	uint32_t version = 0; // Incremented on each merge, outdates queued merges.
+};
+
+// Merge of two adjacent pieces, ordered by cost so that `Set` can be used
+// as a priority queue.
+struct _ConvexMerge {
+	real_t cost = 0.0;
+	int a = 0;
+	int b = 0;
+	uint32_t version_a = 0;
+	uint32_t version_b = 0;
+
+	bool operator<(const _ConvexMerge &p_other) const {
+		if (cost != p_other.cost) {
+			return cost < p_other.cost;
+		}
+		if (a != p_other.a) {
+			return a < p_other.a;
+		}
+		if (b != p_other.b) {
+			return b < p_other.b;
+		}
+		if (version_a != p_other.version_a) {
+			return version_a < p_other.version_a;
+		}
+		return version_b < p_other.version_b;
+	}
+};
+
+struct _ConvexEdge {
+	Point2 a;
+	Point2 b;
+
+	// Exact comparison, as shared edges have identical coordinates.
+	bool operator<(const _ConvexEdge &p_other) const {
+		if (a.x != p_other.a.x) {
+			return a.x < p_other.a.x;
+		}
+		if (a.y != p_other.a.y) {
+			return a.y < p_other.a.y;
+		}
+		if (b.x != p_other.b.x) {
+			return b.x < p_other.b.x;
+		}
+		return b.y < p_other.b.y;
+	}
+};
+
+static Vector<Point2> _convex_hull(const Vector<Point2> &p_points) {
+	Vector<Point2> hull = Geometry::convex_hull_2d(p_points);
+	if (hull.size() > 1) {
+		hull.resize(hull.size() - 1); // The first point is repeated.
+	}
+	return hull;
+}
+
+// The depth of the deepest pocket between the hull and the vertices, which
+// is zero if the vertices form a convex polygon.
+static real_t _hull_concavity(const Vector<Point2> &p_hull, const Vector<Point2> &p_points) {
+	const Point2 *h = p_hull.ptr();
+	const int hull_count = p_hull.size();
+	if (hull_count < 3) {
+		return 0.0;
+	}
+	real_t concavity = 0.0;
+	for (int i = 0; i < p_points.size(); ++i) {
+		const Point2 &p = p_points[i];
+		real_t depth = 1e20;
+		for (int j = 0; j < hull_count; ++j) {
+			const Point2 &a = h[j];
+			const Point2 &b = h[(j + 1) % hull_count];
+			const real_t length = a.distance_to(b);
+			if (length < CMP_EPSILON) {
+				continue;
+			}
+			depth = MIN(depth, Math::abs((b - a).cross(p - a)) / length);
+		}
+		concavity = MAX(concavity, depth);
+	}
+	return concavity;
+}
+
+// Whether convex polygons overlap with more than their boundaries, which
+// pieces sharing an edge do. Uses the separating axis theorem.
+static bool _convex_overlap(const Vector<Point2> &p_a, const Vector<Point2> &p_b) {
+	const Vector<Point2> *polygons[2] = { &p_a, &p_b };
+	for (int k = 0; k < 2; ++k) {
+		const Vector<Point2> &poly = *polygons[k];
+		for (int i = 0; i < poly.size(); ++i) {
+			const Vector2 edge = poly[(i + 1) % poly.size()] - poly[i];
+			if (edge.length_squared() < CMP_EPSILON2) {
+				continue;
+			}
+			const Vector2 axis = edge.tangent().normalized();
+			real_t min_a = 1e20, max_a = -1e20;
+			for (int j = 0; j < p_a.size(); ++j) {
+				const real_t d = axis.dot(p_a[j]);
+				min_a = MIN(min_a, d);
+				max_a = MAX(max_a, d);
+			}
+			real_t min_b = 1e20, max_b = -1e20;
+			for (int j = 0; j < p_b.size(); ++j) {
+				const real_t d = axis.dot(p_b[j]);
+				min_b = MIN(min_b, d);
+				max_b = MAX(max_b, d);
+			}
+			if (max_a <= min_b + CMP_EPSILON || max_b <= min_a + CMP_EPSILON) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+Vector<Vector<Point2>> PolyDecomp2DBackend::decompose_convex_approx(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters) {
+	const Vector<Vector<Point2>> &convex = decompose_convex_hm(p_polygons, p_parameters);
+	const real_t tolerance = p_parameters->get_concavity();
+	const int max_pieces = p_parameters->get_max_pieces();
+
+	Vector<_ConvexPiece> pieces;
+	pieces.resize(convex.size());
+	_ConvexPiece *pcs = pieces.ptrw();
+
+	// Pieces are adjacent if they share an edge, which is traversed in
+	// opposite directions by each of them.
+	Map<_ConvexEdge, int> edges;
+	for (int i = 0; i < convex.size(); ++i) {
+		const Vector<Point2> &poly = convex[i];
+		pcs[i].points = poly;
+		pcs[i].hull = poly;
+		for (int j = 0; j < poly.size(); ++j) {
+			_ConvexEdge e;
+			e.a = poly[j];
+			e.b = poly[(j + 1) % poly.size()];
+			edges[e] = i;
+		}
+	}
+	for (Map<_ConvexEdge, int>::Element *E = edges.front(); E; E = E->next()) {
+		_ConvexEdge twin;
+		twin.a = E->key().b;
+		twin.b = E->key().a;
+		Map<_ConvexEdge, int>::Element *T = edges.find(twin);
+		if (T && T->get() != E->get()) {
+			pcs[E->get()].neighbors.insert(T->get());
+		}
+	}
+	// Greedily merge pieces with the least concavity first. Merges are
+	// queued, and skipped when popped if either piece changed since then.
+	Set<_ConvexMerge> queue;
+	auto queue_merge = [&](int p_a, int p_b) {
+		Vector<Point2> points = pcs[p_a].points;
+		points.append_array(pcs[p_b].points);
+		_ConvexMerge m;
+		m.cost = _hull_concavity(_convex_hull(points), points);
+		m.a = p_a;
+		m.b = p_b;
+		m.version_a = pcs[p_a].version;
+		m.version_b = pcs[p_b].version;
+		queue.insert(m);
+	};
+	for (int i = 0; i < pieces.size(); ++i) {
+		pcs[i].rect = GoostGeometry2D::bounding_rect(pcs[i].hull);
+		for (Set<int>::Element *N = pcs[i].neighbors.front(); N; N = N->next()) {
+			if (N->get() > i) {
+				queue_merge(i, N->get());
+			}
+		}
+	}
+	int piece_count = pieces.size();
+	while (piece_count > 1 && !queue.empty()) {
+		const _ConvexMerge m = queue.front()->get();
+		queue.erase(queue.front());
+
+		_ConvexPiece &a = pcs[m.a];
+		_ConvexPiece &b = pcs[m.b];
+		if (a.merged || b.merged || a.version != m.version_a || b.version != m.version_b) {
+			continue; // Outdated.
+		}
+		const bool over_budget = max_pieces > 0 && piece_count > max_pieces;
+		if (m.cost > tolerance && !over_budget) {
+			break; // Other merges cost at least as much.
+		}
+		Vector<Point2> points = a.points;
+		points.append_array(b.points);
+		const Vector<Point2> &hull = _convex_hull(points);
+		const Rect2 rect = GoostGeometry2D::bounding_rect(hull);
+
+		if (m.cost > tolerance) {
+			// Only within the budget, the hull may cover other pieces.
+			bool overlaps = false;
+			for (int i = 0; i < pieces.size() && !overlaps; ++i) {
+				if (i == m.a || i == m.b || pcs[i].merged || !pcs[i].rect.intersects(rect)) {
+					continue;
+				}
+				overlaps = _convex_overlap(hull, pcs[i].hull);
+			}
+			if (overlaps) {
+				continue;
+			}
+		}
+		a.points = points;
+		a.hull = hull;
+		a.rect = rect;
+		a.version++;
+		b.merged = true;
+
+		for (Set<int>::Element *N = b.neighbors.front(); N; N = N->next()) {
+			const int n = N->get();
+			pcs[n].neighbors.erase(m.b);
+			if (n != m.a) {
+				pcs[n].neighbors.insert(m.a);
+				a.neighbors.insert(n);
+			}
+		}
+		a.neighbors.erase(m.b);
+		b.neighbors.clear();
+
+		for (Set<int>::Element *N = a.neighbors.front(); N; N = N->next()) {
+			queue_merge(MIN(m.a, N->get()), MAX(m.a, N->get()));
+		}
+		--piece_count;
+	}
+	Vector<Vector<Point2>> ret;
+	for (int i = 0; i < pieces.size(); ++i) {
+		if (!pcs[i].merged) {
+			ret.push_back(pcs[i].hull);
+		}
+	}
+	return ret;
+}
+
+Vector<Vector<Point2>> PolyDecomp2DBackend::decompose_paths(const clipperlib::Paths &p_paths, Decomposition p_type, const Ref<PolyDecompParameters2D> &p_parameters) {
+	Vector<Vector<Point2>> polygons;
+	PolyPaths2D::scale_down_polypaths(p_paths, polygons);
+	return decompose_polygons(polygons, p_type, p_parameters);
+}
+
 void PolyDecompParameters2D::set_fill_rule(FillRule p_fill_rule) {
 	fill_rule = p_fill_rule;
 	emit_changed();
 }
 
+void PolyDecompParameters2D::set_concavity(real_t p_concavity) {
+	ERR_FAIL_COND_MSG(p_concavity < 0.0, "Concavity must be non-negative.");
+	concavity = p_concavity;
+	emit_changed();
+}
+
+void PolyDecompParameters2D::set_max_pieces(int p_max_pieces) {
+	ERR_FAIL_COND_MSG(p_max_pieces < 0, "Max pieces must be non-negative.");
+	max_pieces = p_max_pieces;
+	emit_changed();
+}
+
 Vector<Vector<Point2>> PolyDecomp2D::triangulate_polygons(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters) {
-	backend->set_parameters(p_parameters);
-	return backend->triangulate_mono(p_polygons);
+	return backend->decompose_polygons(p_polygons, PolyDecomp2DBackend::DECOMP_TRIANGLES_MONO, configure(p_parameters));
 }
 
 Vector<Vector<Point2>> PolyDecomp2D::decompose_polygons_into_convex(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters) {
-	backend->set_parameters(p_parameters);
-	return backend->decompose_convex_hm(p_polygons);
+	return backend->decompose_polygons(p_polygons, PolyDecomp2DBackend::DECOMP_CONVEX_HM, configure(p_parameters));
 }
 
 Vector<Vector<Point2>> PolyDecomp2D::decompose_polygons(const Vector<Vector<Point2>> &p_polygons, Decomposition p_type, const Ref<PolyDecompParameters2D> &p_parameters) {
-	backend->set_parameters(p_parameters);
-	return backend->decompose_polygons(p_polygons, PolyDecomp2DBackend::Decomposition(p_type));
+	return backend->decompose_polygons(p_polygons, PolyDecomp2DBackend::Decomposition(p_type), configure(p_parameters));
+}
+
+Vector<Vector<Point2>> PolyDecomp2D::triangulate_paths(const Ref<PolyPaths2D> &p_paths, const Ref<PolyDecompParameters2D> &p_parameters) {
+	ERR_FAIL_COND_V(p_paths.is_null(), Vector<Vector<Point2>>());
+	return backend->decompose_paths(p_paths->get_paths(), PolyDecomp2DBackend::DECOMP_TRIANGLES_MONO, configure(p_parameters));
+}
+
+Vector<Vector<Point2>> PolyDecomp2D::decompose_paths(const Ref<PolyPaths2D> &p_paths, Decomposition p_type, const Ref<PolyDecompParameters2D> &p_parameters) {
+	ERR_FAIL_COND_V(p_paths.is_null(), Vector<Vector<Point2>>());
+	return backend->decompose_paths(p_paths->get_paths(), PolyDecomp2DBackend::Decomposition(p_type), configure(p_parameters));
 }
 
 // BIND
@@ -76,6 +478,23 @@ Ref<PolyDecompParameters2D> _PolyDecomp2D::get_parameters() const {
 	return parameters;
 }
 
+void _PolyDecomp2D::set_backend_name(const String &p_name) {
+	PolyDecomp2DBackend *backend = PolyBackends2D::poly_decomp.get_backend_instance(p_name);
+	ERR_FAIL_NULL_MSG(backend, "Backend not found: " + p_name);
+	PolyDecomp2D::set_backend(backend);
+}
+
+String _PolyDecomp2D::get_backend_name() const {
+	const PolyBackend2DManager<PolyDecomp2DBackend *> &manager = PolyBackends2D::poly_decomp;
+	for (int i = 0; i < manager.get_backends_count(); ++i) {
+		const String &name = manager.get_backend_name(i);
+		if (manager.get_backend_instance(name) == PolyDecomp2D::get_backend()) {
+			return name;
+		}
+	}
+	return String();
+}
+
 Array _PolyDecomp2D::triangulate_polygons(Array p_polygons) const {
 	Vector<Vector<Point2>> polygons;
 	for (int i = 0; i < p_polygons.size(); i++) {
@@ -118,16 +537,42 @@ Array _PolyDecomp2D::decompose_polygons(Array p_polygons, Decomposition p_type)
 	return ret;
 }
 
+Array _PolyDecomp2D::triangulate_paths(const Ref<PolyPaths2D> &p_paths) const {
+	const auto &params = singleton == this ? Ref<PolyDecompParameters2D>() : parameters;
+	Vector<Vector<Vector2>> solution = PolyDecomp2D::triangulate_paths(p_paths, params);
+	Array ret;
+	for (int i = 0; i < solution.size(); ++i) {
+		ret.push_back(solution[i]);
+	}
+	return ret;
+}
+
+Array _PolyDecomp2D::decompose_paths(const Ref<PolyPaths2D> &p_paths, Decomposition p_type) const {
+	const auto &params = singleton == this ? Ref<PolyDecompParameters2D>() : parameters;
+	Vector<Vector<Vector2>> solution = PolyDecomp2D::decompose_paths(p_paths, PolyDecomp2D::Decomposition(p_type), params);
+	Array ret;
+	for (int i = 0; i < solution.size(); ++i) {
+		ret.push_back(solution[i]);
+	}
+	return ret;
+}
+
 void _PolyDecomp2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("new_instance"), &_PolyDecomp2D::new_instance);
 
 	ClassDB::bind_method(D_METHOD("set_parameters", "parameters"), &_PolyDecomp2D::set_parameters);
 	ClassDB::bind_method(D_METHOD("get_parameters"), &_PolyDecomp2D::get_parameters);
 
+	ClassDB::bind_method(D_METHOD("set_backend_name", "name"), &_PolyDecomp2D::set_backend_name);
+	ClassDB::bind_method(D_METHOD("get_backend_name"), &_PolyDecomp2D::get_backend_name);
+
 	ClassDB::bind_method(D_METHOD("triangulate_polygons", "polygons"), &_PolyDecomp2D::triangulate_polygons);
 	ClassDB::bind_method(D_METHOD("decompose_polygons_into_convex", "polygons"), &_PolyDecomp2D::decompose_polygons_into_convex);
 	ClassDB::bind_method(D_METHOD("decompose_polygons", "polygons", "type"), &_PolyDecomp2D::decompose_polygons);
 
+	ClassDB::bind_method(D_METHOD("triangulate_paths", "paths"), &_PolyDecomp2D::triangulate_paths);
+	ClassDB::bind_method(D_METHOD("decompose_paths", "paths", "type"), &_PolyDecomp2D::decompose_paths);
+
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "parameters"), "set_parameters", "get_parameters");
 
 	BIND_ENUM_CONSTANT(DECOMP_TRIANGLES_EC);
@@ -135,16 +580,25 @@ void _PolyDecomp2D::_bind_methods() {
 	BIND_ENUM_CONSTANT(DECOMP_TRIANGLES_MONO);
 	BIND_ENUM_CONSTANT(DECOMP_CONVEX_HM);
 	BIND_ENUM_CONSTANT(DECOMP_CONVEX_OPT);
+	BIND_ENUM_CONSTANT(DECOMP_CONVEX_APPROX);
 }
 
 void PolyDecompParameters2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_fill_rule", "fill_rule"), &PolyDecompParameters2D::set_fill_rule);
 	ClassDB::bind_method(D_METHOD("get_fill_rule"), &PolyDecompParameters2D::get_fill_rule);
 
+	ClassDB::bind_method(D_METHOD("set_concavity", "concavity"), &PolyDecompParameters2D::set_concavity);
+	ClassDB::bind_method(D_METHOD("get_concavity"), &PolyDecompParameters2D::get_concavity);
+
+	ClassDB::bind_method(D_METHOD("set_max_pieces", "max_pieces"), &PolyDecompParameters2D::set_max_pieces);
+	ClassDB::bind_method(D_METHOD("get_max_pieces"), &PolyDecompParameters2D::get_max_pieces);
+
 	BIND_ENUM_CONSTANT(FILL_RULE_EVEN_ODD);
 	BIND_ENUM_CONSTANT(FILL_RULE_NON_ZERO);
 	BIND_ENUM_CONSTANT(FILL_RULE_POSITIVE);
 	BIND_ENUM_CONSTANT(FILL_RULE_NEGATIVE);
 
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "fill_rule", PROPERTY_HINT_ENUM, "Even-odd,Non-zero,Positive,Negative"), "set_fill_rule", "get_fill_rule");
+	ADD_PROPERTY(PropertyInfo(Variant::REAL, "concavity", PROPERTY_HINT_RANGE, "0,64,0.01,or_greater"), "set_concavity", "get_concavity");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_pieces", PROPERTY_HINT_RANGE, "0,256,1,or_greater"), "set_max_pieces", "get_max_pieces");
 }
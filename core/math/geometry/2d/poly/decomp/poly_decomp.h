@@ -1,39 +1,43 @@
 #pragma once
 
 #include "core/resource.h"
+#include "../poly_paths_2d.h"
 
 class PolyDecomp2D;
 class PolyDecompParameters2D;
 
 class PolyDecomp2DBackend {
-public:
-	virtual void set_parameters(const Ref<PolyDecompParameters2D> &p_parameters);
-	virtual Ref<PolyDecompParameters2D> get_parameters() { return parameters; }
+	friend struct PolyDecomp2DBatch;
 
+public:
 	enum Decomposition {
 		DECOMP_TRIANGLES_EC,
 		DECOMP_TRIANGLES_OPT,
 		DECOMP_TRIANGLES_MONO,
 		DECOMP_CONVEX_HM,
 		DECOMP_CONVEX_OPT,
+		DECOMP_CONVEX_APPROX,
 	};
-	virtual Vector<Vector<Point2>> decompose_polygons(const Vector<Vector<Point2>> &p_polygons, Decomposition p_type);
+	// Independent groups of polygons (which don't overlap) are decomposed
+	// in parallel if the input is large enough.
+	virtual Vector<Vector<Point2>> decompose_polygons(const Vector<Vector<Point2>> &p_polygons, Decomposition p_type, const Ref<PolyDecompParameters2D> &p_parameters);
+	// Decomposes fixed-point paths, see `PolyPaths2D`. Converts paths to
+	// floating-point coordinates and calls `decompose_polygons()` by default.
+	virtual Vector<Vector<Point2>> decompose_paths(const clipperlib::Paths &p_paths, Decomposition p_type, const Ref<PolyDecompParameters2D> &p_parameters);
+
+	virtual Vector<Vector<Point2>> triangulate_ec(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters) = 0;
+	virtual Vector<Vector<Point2>> triangulate_opt(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters) = 0;
+	virtual Vector<Vector<Point2>> triangulate_mono(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters) = 0;
+	virtual Vector<Vector<Point2>> decompose_convex_hm(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters) = 0;
+	virtual Vector<Vector<Point2>> decompose_convex_opt(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters) = 0;
+	// Merges adjacent pieces produced by `decompose_convex_hm()` while the
+	// concavity of the merged hull is within tolerance, see parameters.
+	virtual Vector<Vector<Point2>> decompose_convex_approx(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters);
 
-	virtual Vector<Vector<Point2>> triangulate_ec(const Vector<Vector<Point2>> &p_polygons) = 0;
-	virtual Vector<Vector<Point2>> triangulate_opt(const Vector<Vector<Point2>> &p_polygons) = 0;
-	virtual Vector<Vector<Point2>> triangulate_mono(const Vector<Vector<Point2>> &p_polygons) = 0;
-	virtual Vector<Vector<Point2>> decompose_convex_hm(const Vector<Vector<Point2>> &p_polygons) = 0;
-	virtual Vector<Vector<Point2>> decompose_convex_opt(const Vector<Vector<Point2>> &p_polygons) = 0;
-
-	PolyDecomp2DBackend() {
-		default_parameters.instance();
-		parameters.instance();
-	}
 	virtual ~PolyDecomp2DBackend() {}
 
-protected:
-	Ref<PolyDecompParameters2D> default_parameters;
-	Ref<PolyDecompParameters2D> parameters;
+private:
+	Vector<Vector<Point2>> _decompose(const Vector<Vector<Point2>> &p_polygons, Decomposition p_type, const Ref<PolyDecompParameters2D> &p_parameters);
 };
 
 class PolyDecomp2D {
@@ -44,16 +48,26 @@ public:
 		DECOMP_TRIANGLES_MONO,
 		DECOMP_CONVEX_HM,
 		DECOMP_CONVEX_OPT,
+		DECOMP_CONVEX_APPROX,
 	};
 	static Vector<Vector<Point2>> triangulate_polygons(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters = Ref<PolyDecompParameters2D>());
 	static Vector<Vector<Point2>> decompose_polygons_into_convex(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters = Ref<PolyDecompParameters2D>());
 	static Vector<Vector<Point2>> decompose_polygons(const Vector<Vector<Point2>> &p_polygons, Decomposition p_type, const Ref<PolyDecompParameters2D> &p_parameters = Ref<PolyDecompParameters2D>());
 
+	static Vector<Vector<Point2>> triangulate_paths(const Ref<PolyPaths2D> &p_paths, const Ref<PolyDecompParameters2D> &p_parameters = Ref<PolyDecompParameters2D>());
+	static Vector<Vector<Point2>> decompose_paths(const Ref<PolyPaths2D> &p_paths, Decomposition p_type, const Ref<PolyDecompParameters2D> &p_parameters = Ref<PolyDecompParameters2D>());
+
 	static void set_backend(PolyDecomp2DBackend *p_backend) { backend = p_backend; }
 	static PolyDecomp2DBackend *get_backend() { return backend; }
 
+	static void initialize();
+	static void finalize();
+
 private:
 	static PolyDecomp2DBackend *backend;
+
+	static Ref<PolyDecompParameters2D> default_parameters;
+	static Ref<PolyDecompParameters2D> configure(const Ref<PolyDecompParameters2D> &p_parameters);
 };
 
 // BIND
@@ -75,17 +89,24 @@ public:
 	void set_parameters(const Ref<PolyDecompParameters2D> &p_parameters);
 	Ref<PolyDecompParameters2D> get_parameters() const;
 
+	void set_backend_name(const String &p_name);
+	String get_backend_name() const;
+
 	enum Decomposition {
 		DECOMP_TRIANGLES_EC,
 		DECOMP_TRIANGLES_OPT,
 		DECOMP_TRIANGLES_MONO,
 		DECOMP_CONVEX_HM,
 		DECOMP_CONVEX_OPT,
+		DECOMP_CONVEX_APPROX,
 	};
 	Array triangulate_polygons(Array p_polygons) const;
 	Array decompose_polygons_into_convex(Array p_polygons) const;
 	Array decompose_polygons(Array p_polygons, Decomposition p_type) const;
 
+	Array triangulate_paths(const Ref<PolyPaths2D> &p_paths) const;
+	Array decompose_paths(const Ref<PolyPaths2D> &p_paths, Decomposition p_type) const;
+
 	_PolyDecomp2D() {
 		if (!singleton) {
 			singleton = this;
@@ -112,6 +133,8 @@ public:
 
 public:
 	FillRule fill_rule = FILL_RULE_NON_ZERO;
+	real_t concavity = 1.0;
+	int max_pieces = 0;
 	// Steiner points...
 	// Inner polygons indices...
 
@@ -122,8 +145,16 @@ public:
 	void set_fill_rule(FillRule p_fill_rule);
 	FillRule get_fill_rule() const { return fill_rule; }
 
+	void set_concavity(real_t p_concavity);
+	real_t get_concavity() const { return concavity; }
+
+	void set_max_pieces(int p_max_pieces);
+	int get_max_pieces() const { return max_pieces; }
+
 	void reset() {
 		fill_rule = FILL_RULE_NON_ZERO;
+		concavity = 1.0;
+		max_pieces = 0;
 	}
 };
 
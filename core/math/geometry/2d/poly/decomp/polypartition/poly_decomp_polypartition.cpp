@@ -59,7 +59,7 @@ Vector<Vector<Point2>> partition(List<TriangulatorPoly> &p_out_poly) {
 	return polys;
 }
 
-Vector<Vector<Point2>> PolyDecomp2DPolyPartition::triangulate_ec(const Vector<Vector<Point2>> &p_polygons) {
+Vector<Vector<Point2>> PolyDecomp2DPolyPartition::triangulate_ec(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters) {
 	List<TriangulatorPoly> in_poly = configure(DECOMP_TRIANGLES_EC, p_polygons);
 	if (in_poly.empty()) {
 		return Vector<Vector<Point2>>();
@@ -74,7 +74,7 @@ Vector<Vector<Point2>> PolyDecomp2DPolyPartition::triangulate_ec(const Vector<Ve
 	return partition(out_poly);
 }
 
-Vector<Vector<Point2>> PolyDecomp2DPolyPartition::triangulate_opt(const Vector<Vector<Point2>> &p_polygons) {
+Vector<Vector<Point2>> PolyDecomp2DPolyPartition::triangulate_opt(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters) {
 	List<TriangulatorPoly> in_poly = configure(DECOMP_TRIANGLES_OPT, p_polygons);
 	if (in_poly.empty()) {
 		return Vector<Vector<Point2>>();
@@ -89,7 +89,7 @@ Vector<Vector<Point2>> PolyDecomp2DPolyPartition::triangulate_opt(const Vector<V
 	return partition(out_poly);
 }
 
-Vector<Vector<Point2>> PolyDecomp2DPolyPartition::triangulate_mono(const Vector<Vector<Point2>> &p_polygons) {
+Vector<Vector<Point2>> PolyDecomp2DPolyPartition::triangulate_mono(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters) {
 	List<TriangulatorPoly> in_poly = configure(DECOMP_TRIANGLES_MONO, p_polygons);
 	if (in_poly.empty()) {
 		return Vector<Vector<Point2>>();
@@ -105,7 +105,7 @@ Vector<Vector<Point2>> PolyDecomp2DPolyPartition::triangulate_mono(const Vector<
 	return partition(out_poly);
 }
 
-Vector<Vector<Point2>> PolyDecomp2DPolyPartition::decompose_convex_hm(const Vector<Vector<Point2>> &p_polygons) {
+Vector<Vector<Point2>> PolyDecomp2DPolyPartition::decompose_convex_hm(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters) {
 	List<TriangulatorPoly> in_poly = configure(DECOMP_CONVEX_HM, p_polygons);
 	if (in_poly.empty()) {
 		return Vector<Vector<Point2>>();
@@ -120,7 +120,7 @@ Vector<Vector<Point2>> PolyDecomp2DPolyPartition::decompose_convex_hm(const Vect
 	return partition(out_poly);
 }
 
-Vector<Vector<Point2>> PolyDecomp2DPolyPartition::decompose_convex_opt(const Vector<Vector<Point2>> &p_polygons) {
+Vector<Vector<Point2>> PolyDecomp2DPolyPartition::decompose_convex_opt(const Vector<Vector<Point2>> &p_polygons, const Ref<PolyDecompParameters2D> &p_parameters) {
 	List<TriangulatorPoly> in_poly = configure(DECOMP_CONVEX_OPT, p_polygons);
 	if (in_poly.empty()) {
 		return Vector<Vector<Point2>>();
@@ -1,15 +1,13 @@
 #include "poly_offset_clipper10.h"
+#include "goost/core/math/geometry/2d/poly/utils/clipper_scratch_paths.h"
 #include "goost/core/math/geometry/2d/poly/utils/godot_clipper10_path_convert.h"
 
-Vector<Vector<Point2>> PolyOffset2DClipper10::offset_polypaths(const Vector<Vector<Point2>> &p_polypaths, real_t p_delta) {
-	clipperlib::ClipperOffset clp = configure(parameters);
+static thread_local clipperlib::Paths subject_buffer;
 
-	clipperlib::Paths subject;
-	GodotClipperUtils::scale_up_polypaths(p_polypaths, subject);
-	clp.AddPaths(subject, join_type, end_type);
-
-	clipperlib::Paths solution;
-	clp.Execute(solution, p_delta * SCALE_FACTOR);
+Vector<Vector<Point2>> PolyOffset2DClipper10::offset_polypaths(const Vector<Vector<Point2>> &p_polypaths, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters) {
+	ClipperScratchPaths<clipperlib::Paths> subject(subject_buffer);
+	GodotClipperUtils::scale_up_polypaths(p_polypaths, subject.get());
+	const clipperlib::Paths solution = offset_paths(subject.get(), p_delta, p_parameters);
 
 	Vector<Vector<Point2>> ret;
 	GodotClipperUtils::scale_down_polypaths(solution, ret);
@@ -17,36 +15,50 @@ Vector<Vector<Point2>> PolyOffset2DClipper10::offset_polypaths(const Vector<Vect
 	return ret;
 }
 
-clipperlib::ClipperOffset PolyOffset2DClipper10::configure(const Ref<PolyOffsetParameters2D> &p_parameters) {
+clipperlib::Paths PolyOffset2DClipper10::offset_paths(const clipperlib::Paths &p_paths, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters) {
+	const Config cfg = configure(p_parameters);
+	clipperlib::ClipperOffset clp(cfg.miter_limit, cfg.arc_tolerance);
+	clp.AddPaths(p_paths, cfg.join_type, cfg.end_type);
+
+	clipperlib::Paths solution;
+	clp.Execute(solution, p_delta * SCALE_FACTOR);
+	return solution;
+}
+
+PolyOffset2DClipper10::Config PolyOffset2DClipper10::configure(const Ref<PolyOffsetParameters2D> &p_parameters) {
 	using namespace clipperlib;
 
+	Config cfg;
 	switch (p_parameters->join_type) {
 		case PolyOffsetParameters2D::JOIN_SQUARE:
-			join_type = kSquare;
+			cfg.join_type = kSquare;
 			break;
 		case PolyOffsetParameters2D::JOIN_ROUND:
-			join_type = kRound;
+			cfg.join_type = kRound;
 			break;
 		case PolyOffsetParameters2D::JOIN_MITER:
-			join_type = kMiter;
+			cfg.join_type = kMiter;
 			break;
 	}
 	switch (p_parameters->end_type) {
 		case PolyOffsetParameters2D::END_POLYGON:
-			end_type = kPolygon;
+			cfg.end_type = kPolygon;
 			break;
 		case PolyOffsetParameters2D::END_JOINED:
-			end_type = kOpenJoined;
+			cfg.end_type = kOpenJoined;
 			break;
 		case PolyOffsetParameters2D::END_BUTT:
-			end_type = kOpenButt;
+			cfg.end_type = kOpenButt;
 			break;
 		case PolyOffsetParameters2D::END_SQUARE:
-			end_type = kOpenSquare;
+			cfg.end_type = kOpenSquare;
 			break;
 		case PolyOffsetParameters2D::END_ROUND:
-			end_type = kOpenRound;
+			cfg.end_type = kOpenRound;
 			break;
 	}
-	return ClipperOffset(p_parameters->miter_limit, p_parameters->arc_tolerance * SCALE_FACTOR);
+	cfg.miter_limit = p_parameters->miter_limit;
+	cfg.arc_tolerance = p_parameters->arc_tolerance * SCALE_FACTOR;
+
+	return cfg;
 }
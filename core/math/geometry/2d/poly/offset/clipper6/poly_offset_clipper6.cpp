@@ -1,15 +1,13 @@
 #include "poly_offset_clipper6.h"
+#include "goost/core/math/geometry/2d/poly/utils/clipper_scratch_paths.h"
 #include "goost/core/math/geometry/2d/poly/utils/godot_clipper6_path_convert.h"
 
-Vector<Vector<Point2>> PolyOffset2DClipper6::offset_polypaths(const Vector<Vector<Point2>> &p_polypaths, real_t p_delta) {
-	ClipperLib::ClipperOffset clp = configure(parameters);
+static thread_local ClipperLib::Paths subject_buffer;
 
-	ClipperLib::Paths subject;
-	GodotClipperUtils::scale_up_polypaths(p_polypaths, subject);
-	clp.AddPaths(subject, join_type, end_type);
-
-	ClipperLib::Paths solution;
-	clp.Execute(solution, p_delta * SCALE_FACTOR);
+Vector<Vector<Point2>> PolyOffset2DClipper6::offset_polypaths(const Vector<Vector<Point2>> &p_polypaths, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters) {
+	ClipperScratchPaths<ClipperLib::Paths> subject(subject_buffer);
+	GodotClipperUtils::scale_up_polypaths(p_polypaths, subject.get());
+	const ClipperLib::Paths solution = execute(subject.get(), p_delta, p_parameters);
 
 	Vector<Vector<Point2>> ret;
 	GodotClipperUtils::scale_down_polypaths(solution, ret);
@@ -17,36 +15,60 @@ Vector<Vector<Point2>> PolyOffset2DClipper6::offset_polypaths(const Vector<Vecto
 	return ret;
 }
 
-ClipperLib::ClipperOffset PolyOffset2DClipper6::configure(const Ref<PolyOffsetParameters2D> &p_parameters) {
+clipperlib::Paths PolyOffset2DClipper6::offset_paths(const clipperlib::Paths &p_paths, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters) {
+	ClipperScratchPaths<ClipperLib::Paths> subject(subject_buffer);
+	GodotClipperUtils::copy_polypaths(p_paths, subject.get());
+	const ClipperLib::Paths solution = execute(subject.get(), p_delta, p_parameters);
+
+	clipperlib::Paths ret;
+	GodotClipperUtils::copy_polypaths(solution, ret);
+	return ret;
+}
+
+ClipperLib::Paths PolyOffset2DClipper6::execute(const ClipperLib::Paths &p_subject, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters) {
+	const Config cfg = configure(p_parameters);
+	ClipperLib::ClipperOffset clp(cfg.miter_limit, cfg.arc_tolerance);
+	clp.AddPaths(p_subject, cfg.join_type, cfg.end_type);
+
+	ClipperLib::Paths solution;
+	clp.Execute(solution, p_delta * SCALE_FACTOR);
+	return solution;
+}
+
+PolyOffset2DClipper6::Config PolyOffset2DClipper6::configure(const Ref<PolyOffsetParameters2D> &p_parameters) {
 	using namespace ClipperLib;
 
+	Config cfg;
 	switch (p_parameters->join_type) {
 		case PolyOffsetParameters2D::JOIN_SQUARE:
-			join_type = jtSquare;
+			cfg.join_type = jtSquare;
 			break;
 		case PolyOffsetParameters2D::JOIN_ROUND:
-			join_type = jtRound;
+			cfg.join_type = jtRound;
 			break;
 		case PolyOffsetParameters2D::JOIN_MITER:
-			join_type = jtMiter;
+			cfg.join_type = jtMiter;
 			break;
 	}
 	switch (p_parameters->end_type) {
 		case PolyOffsetParameters2D::END_POLYGON:
-			end_type = etClosedPolygon;
+			cfg.end_type = etClosedPolygon;
 			break;
 		case PolyOffsetParameters2D::END_JOINED:
-			end_type = etClosedLine;
+			cfg.end_type = etClosedLine;
 			break;
 		case PolyOffsetParameters2D::END_BUTT:
-			end_type = etOpenButt;
+			cfg.end_type = etOpenButt;
 			break;
 		case PolyOffsetParameters2D::END_SQUARE:
-			end_type = etOpenSquare;
+			cfg.end_type = etOpenSquare;
 			break;
 		case PolyOffsetParameters2D::END_ROUND:
-			end_type = etOpenRound;
+			cfg.end_type = etOpenRound;
 			break;
 	}
-	return ClipperOffset(p_parameters->miter_limit, p_parameters->arc_tolerance * SCALE_FACTOR);
+	cfg.miter_limit = p_parameters->miter_limit;
+	cfg.arc_tolerance = p_parameters->arc_tolerance * SCALE_FACTOR;
+
+	return cfg;
 }
@@ -5,11 +5,17 @@
 
 class PolyOffset2DClipper6 : public PolyOffset2DBackend {
 public:
-	virtual Vector<Vector<Point2>> offset_polypaths(const Vector<Vector<Point2>> &p_polypaths, real_t p_delta);
+	virtual Vector<Vector<Point2>> offset_polypaths(const Vector<Vector<Point2>> &p_polypaths, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters);
+	virtual clipperlib::Paths offset_paths(const clipperlib::Paths &p_paths, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters);
 
 private:
-	ClipperLib::ClipperOffset configure(const Ref<PolyOffsetParameters2D> &p_parameters);
-	ClipperLib::JoinType join_type;
-	ClipperLib::EndType end_type;
+	struct Config {
+		ClipperLib::JoinType join_type;
+		ClipperLib::EndType end_type;
+		double miter_limit;
+		double arc_tolerance;
+	};
+	static Config configure(const Ref<PolyOffsetParameters2D> &p_parameters);
+	static ClipperLib::Paths execute(const ClipperLib::Paths &p_subject, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters);
 };
 
@@ -1,39 +1,599 @@
 #include "poly_offset.h"
 
+#include "../boolean/poly_boolean.h"
+#include "../poly_work_pool.h"
+
 PolyOffset2DBackend *PolyOffset2D::backend = nullptr;
+Ref<PolyOffsetParameters2D> PolyOffset2D::default_parameters;
+Ref<PolyOffsetParameters2D> PolyOffset2D::default_parameters_polygons;
+Mutex PolyOffset2D::configure_mutex;
 
-void PolyOffset2DBackend::set_parameters(const Ref<PolyOffsetParameters2D> &p_parameters) {
-	if (p_parameters.is_valid()) {
-		parameters = p_parameters;
-	} else {
-		parameters = Ref<PolyOffsetParameters2D>();
-		parameters = default_parameters;
-		parameters->reset();
+void PolyOffset2D::initialize() {
+	default_parameters.instance();
+	default_parameters_polygons.instance();
+	default_parameters_polygons->end_type = PolyOffsetParameters2D::END_POLYGON;
+}
+
+void PolyOffset2D::finalize() {
+	default_parameters.unref();
+	default_parameters_polygons.unref();
+}
+
+clipperlib::Paths PolyOffset2DBackend::offset_paths(const clipperlib::Paths &p_paths, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters) {
+	Vector<Vector<Point2>> polypaths;
+	PolyPaths2D::scale_down_polypaths(p_paths, polypaths);
+
+	const Vector<Vector<Point2>> &solution = offset_polypaths(polypaths, p_delta, p_parameters);
+
+	clipperlib::Paths ret;
+	PolyPaths2D::scale_up_polypaths(solution, ret);
+	return ret;
+}
+
+Ref<PolyOffsetParameters2D> PolyOffset2D::configure(const Ref<PolyOffsetParameters2D> &p_parameters, bool p_polygons) {
+	if (p_parameters.is_null()) {
+		return p_polygons ? default_parameters_polygons : default_parameters;
 	}
+	PolyOffsetParameters2D::EndType end_type = p_parameters->end_type;
+	if (p_polygons) {
+		end_type = PolyOffsetParameters2D::END_POLYGON;
+	} else if (end_type == PolyOffsetParameters2D::END_POLYGON) {
+		WARN_PRINT_ONCE("END_POLYGON does not apply for polyline deflating, fallback to END_JOINED.");
+		end_type = PolyOffsetParameters2D::END_JOINED;
+	}
+	if (p_parameters->end_type == end_type) {
+		return p_parameters;
+	}
+	// Only one `end_type` can differ from the one set, so a single adjusted
+	// copy is cached, unless other parameters were changed since it was made.
+	configure_mutex.lock();
+	Ref<PolyOffsetParameters2D> params = p_parameters->configured;
+	if (params.is_null() || params->end_type != end_type ||
+			params->join_type != p_parameters->join_type ||
+			params->arc_tolerance != p_parameters->arc_tolerance ||
+			params->miter_limit != p_parameters->miter_limit) {
+		params = p_parameters->duplicate();
+		params->end_type = end_type;
+		p_parameters->configured = params;
+	}
+	configure_mutex.unlock();
+	return params;
 }
 
 Vector<Vector<Point2>> PolyOffset2D::inflate_polygons(const Vector<Vector<Point2>> &p_polygons, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters) {
 	ERR_FAIL_COND_V(p_delta < 0, Vector<Vector<Point2>>());
-	backend->set_parameters(p_parameters);
-	backend->get_parameters()->end_type = PolyOffsetParameters2D::END_POLYGON;
-	return backend->offset_polypaths(p_polygons, -p_delta);
+	Ref<PolyOffsetParameters2D> params = configure(p_parameters, true);
+	return backend->offset_polypaths(p_polygons, -p_delta, params);
 }
 
 Vector<Vector<Point2>> PolyOffset2D::deflate_polygons(const Vector<Vector<Point2>> &p_polygons, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters) {
 	ERR_FAIL_COND_V(p_delta < 0, Vector<Vector<Point2>>());
-	backend->set_parameters(p_parameters);
-	backend->get_parameters()->end_type = PolyOffsetParameters2D::END_POLYGON;
-	return backend->offset_polypaths(p_polygons, p_delta);
+	Ref<PolyOffsetParameters2D> params = configure(p_parameters, true);
+	return backend->offset_polypaths(p_polygons, p_delta, params);
 }
 
 Vector<Vector<Point2>> PolyOffset2D::deflate_polylines(const Vector<Vector<Point2>> &p_polylines, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters) {
 	ERR_FAIL_COND_V(p_delta < 0, Vector<Vector<Point2>>());
-	backend->set_parameters(p_parameters);
-	if (backend->get_parameters()->end_type == PolyOffsetParameters2D::END_POLYGON) {
-		WARN_PRINT_ONCE("END_POLYGON does not apply for polyline deflating, fallback to END_JOINED.");
-		backend->get_parameters()->end_type = PolyOffsetParameters2D::END_JOINED;
+	Ref<PolyOffsetParameters2D> params = configure(p_parameters, false);
+	return backend->offset_polypaths(p_polylines, p_delta, params);
+}
+
+struct PolyOffset2DMultiBatch {
+	PolyOffset2DBackend *backend = nullptr;
+	const clipperlib::Paths *paths = nullptr;
+	const real_t *deltas = nullptr;
+	real_t sign = 1.0;
+	Vector<Vector<Point2>> *results = nullptr;
+	Ref<PolyOffsetParameters2D> parameters;
+
+	void process_delta(uint32_t p_index, void *p_userdata) {
+		const clipperlib::Paths &solution = backend->offset_paths(*paths, deltas[p_index] * sign, parameters);
+		PolyPaths2D::scale_down_polypaths(solution, results[p_index]);
+	}
+};
+
+Vector<Vector<Vector<Point2>>> PolyOffset2D::offset_polygons_multi(const Vector<Vector<Point2>> &p_polygons, const Vector<real_t> &p_deltas, real_t p_sign, const Ref<PolyOffsetParameters2D> &p_parameters) {
+	for (int i = 0; i < p_deltas.size(); ++i) {
+		ERR_FAIL_COND_V(p_deltas[i] < 0, Vector<Vector<Vector<Point2>>>());
+	}
+	// Converted once and shared between all offsets.
+	clipperlib::Paths paths;
+	PolyPaths2D::scale_up_polypaths(p_polygons, paths);
+
+	Vector<Vector<Vector<Point2>>> results;
+	results.resize(p_deltas.size());
+
+	PolyOffset2DMultiBatch batch;
+	batch.backend = backend;
+	batch.paths = &paths;
+	batch.deltas = p_deltas.ptr();
+	batch.sign = p_sign;
+	batch.results = results.ptrw();
+	batch.parameters = configure(p_parameters, true);
+
+	PolyWorkPool2D::do_work(p_deltas.size(), &batch, &PolyOffset2DMultiBatch::process_delta, (void *)nullptr);
+	return results;
+}
+
+Vector<Vector<Vector<Point2>>> PolyOffset2D::inflate_polygons_multi(const Vector<Vector<Point2>> &p_polygons, const Vector<real_t> &p_deltas, const Ref<PolyOffsetParameters2D> &p_parameters) {
+	return offset_polygons_multi(p_polygons, p_deltas, -1.0, p_parameters);
+}
+
+Vector<Vector<Vector<Point2>>> PolyOffset2D::deflate_polygons_multi(const Vector<Vector<Point2>> &p_polygons, const Vector<real_t> &p_deltas, const Ref<PolyOffsetParameters2D> &p_parameters) {
+	return offset_polygons_multi(p_polygons, p_deltas, 1.0, p_parameters);
+}
+
+Ref<PolyPaths2D> PolyOffset2D::inflate_paths(const Ref<PolyPaths2D> &p_paths, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters) {
+	ERR_FAIL_COND_V(p_paths.is_null(), Ref<PolyPaths2D>());
+	ERR_FAIL_COND_V(p_delta < 0, Ref<PolyPaths2D>());
+	Ref<PolyOffsetParameters2D> params = configure(p_parameters, true);
+
+	Ref<PolyPaths2D> ret;
+	ret.instance();
+	ret->get_paths() = backend->offset_paths(p_paths->get_paths(), -p_delta, params);
+	return ret;
+}
+
+Ref<PolyPaths2D> PolyOffset2D::deflate_paths(const Ref<PolyPaths2D> &p_paths, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters) {
+	ERR_FAIL_COND_V(p_paths.is_null(), Ref<PolyPaths2D>());
+	ERR_FAIL_COND_V(p_delta < 0, Ref<PolyPaths2D>());
+	Ref<PolyOffsetParameters2D> params = configure(p_parameters, true);
+
+	Ref<PolyPaths2D> ret;
+	ret.instance();
+	ret->get_paths() = backend->offset_paths(p_paths->get_paths(), p_delta, params);
+	return ret;
+}
+
+Ref<PolyOffsetCache2D> PolyOffset2D::inflate_polygons_cached(const Vector<Vector<Point2>> &p_polygons, real_t p_max_delta, const Ref<PolyOffsetParameters2D> &p_parameters) {
+	ERR_FAIL_COND_V(p_max_delta < 0, Ref<PolyOffsetCache2D>());
+	Ref<PolyOffsetCache2D> cache;
+	cache.instance();
+	cache->build(p_polygons, -p_max_delta, configure(p_parameters, true));
+	return cache;
+}
+
+Ref<PolyOffsetCache2D> PolyOffset2D::deflate_polygons_cached(const Vector<Vector<Point2>> &p_polygons, real_t p_max_delta, const Ref<PolyOffsetParameters2D> &p_parameters) {
+	ERR_FAIL_COND_V(p_max_delta < 0, Ref<PolyOffsetCache2D>());
+	Ref<PolyOffsetCache2D> cache;
+	cache.instance();
+	cache->build(p_polygons, p_max_delta, configure(p_parameters, true));
+	return cache;
+}
+
+Ref<PolyOffsetCache2D> PolyOffset2D::deflate_polylines_cached(const Vector<Vector<Point2>> &p_polylines, real_t p_max_delta, const Ref<PolyOffsetParameters2D> &p_parameters) {
+	ERR_FAIL_COND_V(p_max_delta < 0, Ref<PolyOffsetCache2D>());
+	Ref<PolyOffsetCache2D> cache;
+	cache.instance();
+	cache->build(p_polylines, p_max_delta, configure(p_parameters, false));
+	return cache;
+}
+
+// PolyOffsetCache2D
+
+// Follows `clipperlib::ClipperOffset`, but records the direction in which
+// each vertex moves instead of the offset vertex itself.
+struct _PolyOffsetBuilder {
+	struct Path {
+		Vector<Point2> points;
+		PolyOffsetParameters2D::EndType end_type;
+		int lowest = 0;
+	};
+	PolyOffsetParameters2D::JoinType join_type;
+	real_t delta = 0.0; // Signed, used for choosing joins.
+	real_t miter_lim = 0.5;
+	real_t steps = 0.0;
+	real_t steps_per_radian = 0.0;
+	real_t arc_sin = 0.0;
+	real_t arc_cos = 1.0;
+	real_t sin_a = 0.0;
+
+	const Point2 *path = nullptr;
+	int count = 0;
+	bool reversed = false; // Whether normals are reversed along the path.
+	bool simplify_inner = false;
+	Vector<Vector2> norms;
+	PolyOffsetCache2D::Outline *outline = nullptr;
+
+	_FORCE_INLINE_ void add(int j, const Vector2 &p_dir) {
+		outline->points.push_back(path[j]);
+		// Stored for the absolute value of delta.
+		outline->directions.push_back(delta < 0 ? -p_dir : p_dir);
+	}
+
+	void begin_outline(Vector<PolyOffsetCache2D::Outline> &r_outlines) {
+		r_outlines.push_back(PolyOffsetCache2D::Outline());
+		outline = &r_outlines.write[r_outlines.size() - 1];
+	}
+
+	// Length of the edge which has the normal at `p_idx`.
+	real_t edge_length(int p_idx) const {
+		const int a = reversed ? (p_idx + count - 1) % count : p_idx;
+		return path[a].distance_to(path[(a + 1) % count]);
+	}
+
+	void do_inner(int j, int k) {
+		const int index = outline->points.size();
+		add(j, norms[k]);
+		add(j, Vector2());
+		add(j, norms[j]);
+
+		if (!simplify_inner) {
+			return;
+		}
+		const real_t cos_a_plus_1 = 1 + norms[k].dot(norms[j]);
+		if (cos_a_plus_1 < CMP_EPSILON) {
+			return; // Spike.
+		}
+		// Offset edges are shortened by `delta * |sin_a| / (1 + cos_a)` at
+		// each end, make sure they don't overlap with the ones of neighbors.
+		PolyOffsetCache2D::InnerJoin join;
+		join.index = index;
+		join.direction = (norms[k] + norms[j]) / cos_a_plus_1;
+		if (delta < 0) {
+			join.direction = -join.direction;
+		}
+		join.max_delta = 0.5 * MIN(edge_length(k), edge_length(j)) * cos_a_plus_1 / Math::abs(sin_a);
+		outline->inner_joins.push_back(join);
+	}
+
+	static Vector2 unit_normal(const Point2 &p_a, const Point2 &p_b) {
+		const Vector2 d = p_b - p_a;
+		if (d == Vector2()) {
+			return Vector2();
+		}
+		const Vector2 n = d.normalized();
+		return Vector2(n.y, -n.x);
+	}
+
+	void do_square(int j, int k) {
+		const Vector2 &nj = norms[j];
+		const Vector2 &nk = norms[k];
+		if (delta > 0) {
+			add(j, Vector2(nk.x - nk.y, nk.y + nk.x));
+			add(j, Vector2(nj.x + nj.y, nj.y - nj.x));
+		} else {
+			add(j, Vector2(nk.x + nk.y, nk.y - nk.x));
+			add(j, Vector2(nj.x - nj.y, nj.y + nj.x));
+		}
+	}
+
+	void do_miter(int j, int k, real_t p_cos_a_plus_1) {
+		add(j, (norms[k] + norms[j]) / p_cos_a_plus_1);
+	}
+
+	void do_round(int j, int k) {
+		const real_t a = Math::atan2(sin_a, norms[k].dot(norms[j]));
+		const int count = MAX(int(Math::round(steps_per_radian * Math::abs(a))), 1);
+		Vector2 v = norms[k];
+		for (int i = 0; i < count; ++i) {
+			add(j, v);
+			v = Vector2(v.x * arc_cos - arc_sin * v.y, v.x * arc_sin + v.y * arc_cos);
+		}
+		add(j, norms[j]);
+	}
+
+	void offset_point(int j, int &k) {
+		sin_a = norms[k].cross(norms[j]);
+		if (Math::abs(sin_a * delta) * SCALE_FACTOR < 1.0) {
+			// Nearly collinear edges, offset with a single vertex.
+			if (norms[k].dot(norms[j]) > 0) {
+				add(j, norms[k]);
+				return;
+			}
+		} else {
+			sin_a = CLAMP(sin_a, -1.0, 1.0);
+		}
+		if (sin_a * delta < 0) {
+			// Concave, the overlap is removed when merging outlines.
+			do_inner(j, k);
+		} else {
+			const real_t cos_a = norms[j].dot(norms[k]);
+			switch (join_type) {
+				case PolyOffsetParameters2D::JOIN_MITER: {
+					if (1 + cos_a < miter_lim) {
+						do_square(j, k);
+					} else {
+						do_miter(j, k, 1 + cos_a);
+					}
+				} break;
+				case PolyOffsetParameters2D::JOIN_SQUARE: {
+					if (cos_a >= 0) {
+						do_miter(j, k, 1 + cos_a);
+					} else {
+						do_square(j, k);
+					}
+				} break;
+				case PolyOffsetParameters2D::JOIN_ROUND: {
+					do_round(j, k);
+				} break;
+			}
+		}
+		k = j;
+	}
+
+	void offset_single_point() {
+		if (join_type == PolyOffsetParameters2D::JOIN_ROUND) {
+			Vector2 v(1, 0);
+			for (int i = 1; i <= steps; ++i) {
+				add(0, v);
+				v = Vector2(v.x * arc_cos - arc_sin * v.y, v.x * arc_sin + v.y * arc_cos);
+			}
+		} else {
+			add(0, Vector2(-1, -1));
+			add(0, Vector2(1, -1));
+			add(0, Vector2(1, 1));
+			add(0, Vector2(-1, 1));
+		}
+	}
+
+	void offset_path(const Path &p_path, Vector<PolyOffsetCache2D::Outline> &r_outlines);
+	void offset_open_path(const Path &p_path);
+};
+
+void _PolyOffsetBuilder::offset_path(const Path &p_path, Vector<PolyOffsetCache2D::Outline> &r_outlines) {
+	path = p_path.points.ptr();
+	count = p_path.points.size();
+	reversed = false;
+	// Overlaps of closed paths may affect winding elsewhere if polygons
+	// intersect themselves, so only outlines of open paths are simplified.
+	simplify_inner = p_path.end_type != PolyOffsetParameters2D::END_POLYGON && p_path.end_type != PolyOffsetParameters2D::END_JOINED;
+	begin_outline(r_outlines);
+
+	if (count == 1) {
+		offset_single_point();
+		return;
+	}
+	norms.resize(count);
+	Vector2 *n = norms.ptrw();
+	for (int j = 0; j < count - 1; ++j) {
+		n[j] = unit_normal(path[j], path[j + 1]);
+	}
+	if (p_path.end_type == PolyOffsetParameters2D::END_POLYGON || p_path.end_type == PolyOffsetParameters2D::END_JOINED) {
+		n[count - 1] = unit_normal(path[count - 1], path[0]);
+	} else {
+		n[count - 1] = n[count - 2];
+	}
+	if (p_path.end_type == PolyOffsetParameters2D::END_POLYGON) {
+		int k = count - 1;
+		for (int j = 0; j < count; ++j) {
+			offset_point(j, k);
+		}
+	} else if (p_path.end_type == PolyOffsetParameters2D::END_JOINED) {
+		int k = count - 1;
+		for (int j = 0; j < count; ++j) {
+			offset_point(j, k);
+		}
+		// The other side, in reverse.
+		begin_outline(r_outlines);
+		reversed = true;
+
+		const Vector2 last = n[count - 1];
+		for (int j = count - 1; j > 0; --j) {
+			n[j] = -n[j - 1];
+		}
+		n[0] = -last;
+		k = 0;
+		for (int j = count - 1; j >= 0; --j) {
+			offset_point(j, k);
+		}
+	} else {
+		offset_open_path(p_path);
+	}
+}
+
+void _PolyOffsetBuilder::offset_open_path(const Path &p_path) {
+	Vector2 *n = norms.ptrw();
+
+	int k = 0;
+	for (int j = 1; j < count - 1; ++j) {
+		offset_point(j, k);
+	}
+	// End cap.
+	if (p_path.end_type == PolyOffsetParameters2D::END_BUTT) {
+		add(count - 1, n[count - 1]);
+		add(count - 1, -n[count - 1]);
+	} else {
+		sin_a = 0;
+		n[count - 1] = -n[count - 1];
+		if (p_path.end_type == PolyOffsetParameters2D::END_SQUARE) {
+			do_square(count - 1, count - 2);
+		} else {
+			do_round(count - 1, count - 2);
+		}
+	}
+	// The other side, in reverse.
+	for (int j = count - 1; j > 0; --j) {
+		n[j] = -n[j - 1];
+	}
+	n[0] = -n[1];
+	reversed = true;
+	k = count - 1;
+	for (int j = k - 1; j > 0; --j) {
+		offset_point(j, k);
+	}
+	// Start cap.
+	if (p_path.end_type == PolyOffsetParameters2D::END_BUTT) {
+		add(0, -n[0]);
+		add(0, n[0]);
+	} else {
+		sin_a = 0;
+		if (p_path.end_type == PolyOffsetParameters2D::END_SQUARE) {
+			do_square(0, 1);
+		} else {
+			do_round(0, 1);
+		}
 	}
-	return backend->offset_polypaths(p_polylines, p_delta);
+}
+
+void PolyOffsetCache2D::build(const Vector<Vector<Point2>> &p_polypaths, real_t p_max_delta, const Ref<PolyOffsetParameters2D> &p_parameters) {
+	ERR_FAIL_COND(p_parameters.is_null());
+
+	outlines.clear();
+	polygons.clear();
+	max_delta = Math::abs(p_max_delta);
+	polypaths = p_polypaths;
+	parameters = p_parameters;
+	sign = p_max_delta < 0 ? -1.0 : 1.0;
+
+	const PolyOffsetParameters2D::EndType end_type = p_parameters->end_type;
+	const PolyOffsetParameters2D::JoinType join_type = p_parameters->join_type;
+
+	// Remove duplicate points, and find the lowest point of all polygons
+	// to determine their orientation, same as Clipper does.
+	Vector<_PolyOffsetBuilder::Path> paths;
+	int lowest_path = -1;
+	for (int i = 0; i < p_polypaths.size(); ++i) {
+		const Vector<Point2> &polypath = p_polypaths[i];
+		const Point2 *r = polypath.ptr();
+		int len = polypath.size();
+		const bool closed = end_type == PolyOffsetParameters2D::END_POLYGON || end_type == PolyOffsetParameters2D::END_JOINED;
+		if (closed) {
+			while (len > 1 && r[len - 1] == r[0]) {
+				len--;
+			}
+		} else if (len == 2 && r[1] == r[0]) {
+			len = 1;
+		}
+		if (len == 0) {
+			continue;
+		}
+		_PolyOffsetBuilder::Path path;
+		path.end_type = end_type;
+		if (len < 3 && closed) {
+			path.end_type = join_type == PolyOffsetParameters2D::JOIN_ROUND ? PolyOffsetParameters2D::END_ROUND : PolyOffsetParameters2D::END_SQUARE;
+		}
+		path.points.push_back(r[0]);
+		for (int j = 1; j < len; ++j) {
+			const Point2 &last = path.points[path.points.size() - 1];
+			if (r[j] == last) {
+				continue;
+			}
+			path.points.push_back(r[j]);
+			if (path.end_type != PolyOffsetParameters2D::END_POLYGON) {
+				continue;
+			}
+			const Point2 &p = r[j];
+			const Point2 &lowest = path.points[path.lowest];
+			if (p.y > lowest.y || (p.y == lowest.y && p.x < lowest.x)) {
+				path.lowest = path.points.size() - 1;
+			}
+		}
+		if (path.end_type == PolyOffsetParameters2D::END_POLYGON) {
+			if (path.points.size() < 3) {
+				continue;
+			}
+			polygons.push_back(path.points);
+			if (lowest_path < 0) {
+				lowest_path = paths.size();
+			} else {
+				const Point2 &p = path.points[path.lowest];
+				const Point2 &lowest = paths[lowest_path].points[paths[lowest_path].lowest];
+				if (p.y > lowest.y || (p.y == lowest.y && p.x < lowest.x)) {
+					lowest_path = paths.size();
+				}
+			}
+		}
+		paths.push_back(path);
+	}
+	// Reversed orientation of polygons, so reverse the delta as well.
+	bool negate = false;
+	if (lowest_path >= 0) {
+		const Vector<Point2> &points = paths[lowest_path].points;
+		real_t a = 0.0;
+		for (int i = 0, j = points.size() - 1; i < points.size(); ++i) {
+			a += (points[j].x + points[i].x) * (points[j].y - points[i].y);
+			j = i;
+		}
+		negate = -a * 0.5 < 0;
+	}
+	merge_parameters.instance();
+	if (negate) {
+		merge_parameters->subject_fill_rule = PolyBooleanParameters2D::FILL_RULE_NEGATIVE;
+	} else {
+		merge_parameters->subject_fill_rule = PolyBooleanParameters2D::FILL_RULE_POSITIVE;
+	}
+	if (max_delta < CMP_EPSILON) {
+		return; // Zero offset returns polygons as is.
+	}
+	_PolyOffsetBuilder builder;
+	builder.join_type = join_type;
+	builder.delta = negate ? -p_max_delta : p_max_delta;
+
+	const real_t miter_limit = p_parameters->miter_limit;
+	builder.miter_lim = miter_limit > 2 ? 2 / (miter_limit * miter_limit) : 0.5;
+
+	real_t arc_tolerance = p_parameters->arc_tolerance;
+	if (arc_tolerance * SCALE_FACTOR < 0.02) {
+		arc_tolerance = max_delta * 0.02;
+	}
+	builder.steps = Math_PI / Math::acos(CLAMP(1 - arc_tolerance / max_delta, -1.0, 1.0)); // Per 360 degrees.
+	builder.steps = MIN(builder.steps, max_delta * SCALE_FACTOR * Math_PI);
+	builder.arc_sin = Math::sin(Math_TAU / builder.steps);
+	builder.arc_cos = Math::cos(Math_TAU / builder.steps);
+	if (builder.delta < 0) {
+		builder.arc_sin = -builder.arc_sin;
+	}
+	builder.steps_per_radian = builder.steps / Math_TAU;
+
+	for (int i = 0; i < paths.size(); ++i) {
+		builder.offset_path(paths[i], outlines);
+	}
+}
+
+Vector<Vector<Point2>> PolyOffsetCache2D::offset(real_t p_delta) const {
+	ERR_FAIL_COND_V(p_delta < 0, Vector<Vector<Point2>>());
+
+	if (p_delta < CMP_EPSILON || max_delta < CMP_EPSILON) {
+		return polygons;
+	}
+	if (Math::is_equal_approx(p_delta, max_delta)) {
+		return PolyOffset2D::get_backend()->offset_polypaths(polypaths, max_delta * sign, parameters);
+	}
+	Vector<Vector<Point2>> solution;
+	solution.resize(outlines.size());
+
+	for (int i = 0; i < outlines.size(); ++i) {
+		const Outline &outline = outlines[i];
+		const Point2 *p = outline.points.ptr();
+		const Vector2 *d = outline.directions.ptr();
+		const InnerJoin *joins = outline.inner_joins.ptr();
+		const int join_count = outline.inner_joins.size();
+
+		Vector<Point2> &offset = solution.write[i];
+		offset.resize(outline.points.size());
+		Point2 *w = offset.ptrw();
+		int size = 0;
+		int next_join = 0;
+		for (int j = 0; j < outline.points.size(); ++j) {
+			if (next_join < join_count && joins[next_join].index == j) {
+				const InnerJoin &join = joins[next_join++];
+				if (p_delta <= join.max_delta) {
+					w[size++] = p[j] + join.direction * p_delta;
+					j += 2;
+					continue;
+				}
+			}
+			w[size++] = p[j] + d[j] * p_delta;
+		}
+		offset.resize(size);
+	}
+	// Resolve overlaps at concave joins and between outlines.
+	return PolyBoolean2D::merge_polygons(solution, Vector<Vector<Point2>>(), merge_parameters);
+}
+
+Array PolyOffsetCache2D::offset_array(real_t p_delta) const {
+	const Vector<Vector<Point2>> &solution = offset(p_delta);
+	Array ret;
+	for (int i = 0; i < solution.size(); ++i) {
+		ret.push_back(solution[i]);
+	}
+	return ret;
+}
+
+void PolyOffsetCache2D::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("offset", "delta"), &PolyOffsetCache2D::offset_array);
+	ClassDB::bind_method(D_METHOD("get_max_delta"), &PolyOffsetCache2D::get_max_delta);
 }
 
 void PolyOffsetParameters2D::set_join_type(JoinType p_join_type) {
@@ -120,6 +680,91 @@ Array _PolyOffset2D::deflate_polylines(Array p_polylines, real_t p_delta) const
 	return ret;
 }
 
+Array _PolyOffset2D::inflate_polygons_multi(Array p_polygons, const PoolRealArray &p_deltas) const {
+	Vector<Vector<Point2>> polygons;
+	for (int i = 0; i < p_polygons.size(); i++) {
+		polygons.push_back(p_polygons[i]);
+	}
+	Vector<real_t> deltas;
+	deltas.resize(p_deltas.size());
+	PoolRealArray::Read r = p_deltas.read();
+	for (int i = 0; i < p_deltas.size(); i++) {
+		deltas.write[i] = r[i];
+	}
+	const auto &params = singleton == this ? Ref<PolyOffsetParameters2D>() : parameters;
+	Vector<Vector<Vector<Point2>>> solutions = PolyOffset2D::inflate_polygons_multi(polygons, deltas, params);
+	Array ret;
+	for (int i = 0; i < solutions.size(); ++i) {
+		Array solution;
+		for (int j = 0; j < solutions[i].size(); ++j) {
+			solution.push_back(solutions[i][j]);
+		}
+		ret.push_back(solution);
+	}
+	return ret;
+}
+
+Array _PolyOffset2D::deflate_polygons_multi(Array p_polygons, const PoolRealArray &p_deltas) const {
+	Vector<Vector<Point2>> polygons;
+	for (int i = 0; i < p_polygons.size(); i++) {
+		polygons.push_back(p_polygons[i]);
+	}
+	Vector<real_t> deltas;
+	deltas.resize(p_deltas.size());
+	PoolRealArray::Read r = p_deltas.read();
+	for (int i = 0; i < p_deltas.size(); i++) {
+		deltas.write[i] = r[i];
+	}
+	const auto &params = singleton == this ? Ref<PolyOffsetParameters2D>() : parameters;
+	Vector<Vector<Vector<Point2>>> solutions = PolyOffset2D::deflate_polygons_multi(polygons, deltas, params);
+	Array ret;
+	for (int i = 0; i < solutions.size(); ++i) {
+		Array solution;
+		for (int j = 0; j < solutions[i].size(); ++j) {
+			solution.push_back(solutions[i][j]);
+		}
+		ret.push_back(solution);
+	}
+	return ret;
+}
+
+Ref<PolyPaths2D> _PolyOffset2D::inflate_paths(const Ref<PolyPaths2D> &p_paths, real_t p_delta) const {
+	const auto &params = singleton == this ? Ref<PolyOffsetParameters2D>() : parameters;
+	return PolyOffset2D::inflate_paths(p_paths, p_delta, params);
+}
+
+Ref<PolyPaths2D> _PolyOffset2D::deflate_paths(const Ref<PolyPaths2D> &p_paths, real_t p_delta) const {
+	const auto &params = singleton == this ? Ref<PolyOffsetParameters2D>() : parameters;
+	return PolyOffset2D::deflate_paths(p_paths, p_delta, params);
+}
+
+Ref<PolyOffsetCache2D> _PolyOffset2D::inflate_polygons_cached(Array p_polygons, real_t p_max_delta) const {
+	Vector<Vector<Point2>> polygons;
+	for (int i = 0; i < p_polygons.size(); i++) {
+		polygons.push_back(p_polygons[i]);
+	}
+	const auto &params = singleton == this ? Ref<PolyOffsetParameters2D>() : parameters;
+	return PolyOffset2D::inflate_polygons_cached(polygons, p_max_delta, params);
+}
+
+Ref<PolyOffsetCache2D> _PolyOffset2D::deflate_polygons_cached(Array p_polygons, real_t p_max_delta) const {
+	Vector<Vector<Point2>> polygons;
+	for (int i = 0; i < p_polygons.size(); i++) {
+		polygons.push_back(p_polygons[i]);
+	}
+	const auto &params = singleton == this ? Ref<PolyOffsetParameters2D>() : parameters;
+	return PolyOffset2D::deflate_polygons_cached(polygons, p_max_delta, params);
+}
+
+Ref<PolyOffsetCache2D> _PolyOffset2D::deflate_polylines_cached(Array p_polylines, real_t p_max_delta) const {
+	Vector<Vector<Point2>> polylines;
+	for (int i = 0; i < p_polylines.size(); i++) {
+		polylines.push_back(p_polylines[i]);
+	}
+	const auto &params = singleton == this ? Ref<PolyOffsetParameters2D>() : parameters;
+	return PolyOffset2D::deflate_polylines_cached(polylines, p_max_delta, params);
+}
+
 void _PolyOffset2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("new_instance"), &_PolyOffset2D::new_instance);
 
@@ -130,6 +775,16 @@ void _PolyOffset2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("deflate_polygons", "polygons", "delta"), &_PolyOffset2D::deflate_polygons);
 	ClassDB::bind_method(D_METHOD("deflate_polylines", "polylines", "delta"), &_PolyOffset2D::deflate_polylines);
 
+	ClassDB::bind_method(D_METHOD("inflate_polygons_multi", "polygons", "deltas"), &_PolyOffset2D::inflate_polygons_multi);
+	ClassDB::bind_method(D_METHOD("deflate_polygons_multi", "polygons", "deltas"), &_PolyOffset2D::deflate_polygons_multi);
+
+	ClassDB::bind_method(D_METHOD("inflate_paths", "paths", "delta"), &_PolyOffset2D::inflate_paths);
+	ClassDB::bind_method(D_METHOD("deflate_paths", "paths", "delta"), &_PolyOffset2D::deflate_paths);
+
+	ClassDB::bind_method(D_METHOD("inflate_polygons_cached", "polygons", "max_delta"), &_PolyOffset2D::inflate_polygons_cached);
+	ClassDB::bind_method(D_METHOD("deflate_polygons_cached", "polygons", "max_delta"), &_PolyOffset2D::deflate_polygons_cached);
+	ClassDB::bind_method(D_METHOD("deflate_polylines_cached", "polylines", "max_delta"), &_PolyOffset2D::deflate_polylines_cached);
+
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "parameters"), "set_parameters", "get_parameters");
 }
 
@@ -1,40 +1,107 @@
 #pragma once
 
+#include "core/os/mutex.h"
 #include "core/resource.h"
+#include "../poly_paths_2d.h"
 
 class PolyOffset2D;
 class PolyOffsetParameters2D;
+class PolyOffsetCache2D;
+class PolyBooleanParameters2D;
 
 class PolyOffset2DBackend {
 public:
-	virtual void set_parameters(const Ref<PolyOffsetParameters2D> &p_parameters);
-	virtual Ref<PolyOffsetParameters2D> get_parameters() { return parameters; }
+	virtual Vector<Vector<Point2>> offset_polypaths(const Vector<Vector<Point2>> &p_polypaths, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters) = 0;
+	// Fixed-point version of `offset_polypaths()`, see `PolyPaths2D`.
+	// The default implementation converts to floating-point coordinates and back.
+	virtual clipperlib::Paths offset_paths(const clipperlib::Paths &p_paths, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters);
 
-	virtual Vector<Vector<Point2>> offset_polypaths(const Vector<Vector<Point2>> &p_polypaths, real_t p_delta) = 0;
-
-	PolyOffset2DBackend() {
-		default_parameters.instance();
-		parameters.instance();
-	}
 	virtual ~PolyOffset2DBackend() {}
-
-protected:
-	Ref<PolyOffsetParameters2D> default_parameters;
-	Ref<PolyOffsetParameters2D> parameters;
 };
 
-
 class PolyOffset2D {
 public:
 	static Vector<Vector<Point2>> inflate_polygons(const Vector<Vector<Point2>> &p_polygons, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters = Ref<PolyOffsetParameters2D>());
 	static Vector<Vector<Point2>> deflate_polygons(const Vector<Vector<Point2>> &p_polygons, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters = Ref<PolyOffsetParameters2D>());
 	static Vector<Vector<Point2>> deflate_polylines(const Vector<Vector<Point2>> &p_polylines, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters = Ref<PolyOffsetParameters2D>());
 
+	// Offset the same polygons by each delta, converting the input only once.
+	// Deltas are processed on `PolyWorkPool2D`, results are in the same order.
+	static Vector<Vector<Vector<Point2>>> inflate_polygons_multi(const Vector<Vector<Point2>> &p_polygons, const Vector<real_t> &p_deltas, const Ref<PolyOffsetParameters2D> &p_parameters = Ref<PolyOffsetParameters2D>());
+	static Vector<Vector<Vector<Point2>>> deflate_polygons_multi(const Vector<Vector<Point2>> &p_polygons, const Vector<real_t> &p_deltas, const Ref<PolyOffsetParameters2D> &p_parameters = Ref<PolyOffsetParameters2D>());
+
+	static Ref<PolyPaths2D> inflate_paths(const Ref<PolyPaths2D> &p_paths, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters = Ref<PolyOffsetParameters2D>());
+	static Ref<PolyPaths2D> deflate_paths(const Ref<PolyPaths2D> &p_paths, real_t p_delta, const Ref<PolyOffsetParameters2D> &p_parameters = Ref<PolyOffsetParameters2D>());
+
+	// Same as above, but return a cache which can offset the same input at
+	// different deltas up to `p_max_delta` much faster, see `PolyOffsetCache2D`.
+	static Ref<PolyOffsetCache2D> inflate_polygons_cached(const Vector<Vector<Point2>> &p_polygons, real_t p_max_delta, const Ref<PolyOffsetParameters2D> &p_parameters = Ref<PolyOffsetParameters2D>());
+	static Ref<PolyOffsetCache2D> deflate_polygons_cached(const Vector<Vector<Point2>> &p_polygons, real_t p_max_delta, const Ref<PolyOffsetParameters2D> &p_parameters = Ref<PolyOffsetParameters2D>());
+	static Ref<PolyOffsetCache2D> deflate_polylines_cached(const Vector<Vector<Point2>> &p_polylines, real_t p_max_delta, const Ref<PolyOffsetParameters2D> &p_parameters = Ref<PolyOffsetParameters2D>());
+
 	static void set_backend(PolyOffset2DBackend *p_backend) { backend = p_backend; }
 	static PolyOffset2DBackend *get_backend() { return backend; }
 
+	static void initialize();
+	static void finalize();
+
 private:
 	static PolyOffset2DBackend *backend;
+
+	static Ref<PolyOffsetParameters2D> default_parameters;
+	static Ref<PolyOffsetParameters2D> default_parameters_polygons;
+	static Mutex configure_mutex;
+	static Ref<PolyOffsetParameters2D> configure(const Ref<PolyOffsetParameters2D> &p_parameters, bool p_polygons);
+	static Vector<Vector<Vector<Point2>>> offset_polygons_multi(const Vector<Vector<Point2>> &p_polygons, const Vector<real_t> &p_deltas, real_t p_sign, const Ref<PolyOffsetParameters2D> &p_parameters);
+};
+
+// Offsets the same paths at different deltas. Before self-intersections are
+// resolved, offset outlines are linear in delta: each vertex is displaced
+// along a direction which depends on the joins only. Those are computed once
+// in `build()`, so that offsetting only has to scale them and merge the
+// resulting outlines. Round joins and ends are approximated for `max_delta`,
+// offsetting at larger deltas produces coarser arcs. Offsetting by exactly
+// `max_delta` is done by the active backend.
+class PolyOffsetCache2D : public Reference {
+	GDCLASS(PolyOffsetCache2D, Reference);
+
+	friend struct _PolyOffsetBuilder;
+
+	// Concave joins produce three vertices which overlap the outline. Up to
+	// some delta, they can be replaced by the intersection of adjacent offset
+	// edges, which leaves less overlaps to resolve when merging. Only done
+	// for open paths.
+	struct InnerJoin {
+		int index = 0; // First of the three vertices.
+		Vector2 direction;
+		real_t max_delta = 0.0;
+	};
+	struct Outline {
+		Vector<Point2> points;
+		Vector<Vector2> directions; // Displacement per unit of delta.
+		Vector<InnerJoin> inner_joins;
+	};
+	Vector<Outline> outlines;
+	Vector<Vector<Point2>> polygons; // Returned as is at zero delta.
+	Ref<PolyBooleanParameters2D> merge_parameters;
+	real_t max_delta = 0.0;
+
+	Vector<Vector<Point2>> polypaths; // Passed to the backend at `max_delta`.
+	Ref<PolyOffsetParameters2D> parameters;
+	real_t sign = 1.0;
+
+protected:
+	static void _bind_methods();
+
+public:
+	// Same conventions as `PolyOffset2DBackend::offset_polypaths()`, negative
+	// delta shrinks polygons.
+	void build(const Vector<Vector<Point2>> &p_polypaths, real_t p_max_delta, const Ref<PolyOffsetParameters2D> &p_parameters);
+
+	Vector<Vector<Point2>> offset(real_t p_delta) const;
+	Array offset_array(real_t p_delta) const;
+
+	real_t get_max_delta() const { return max_delta; }
 };
 
 // BIND
@@ -60,6 +127,16 @@ public:
 	Array deflate_polygons(Array p_polygons, real_t p_delta) const;
 	Array deflate_polylines(Array p_polylines, real_t p_delta) const;
 
+	Array inflate_polygons_multi(Array p_polygons, const PoolRealArray &p_deltas) const;
+	Array deflate_polygons_multi(Array p_polygons, const PoolRealArray &p_deltas) const;
+
+	Ref<PolyPaths2D> inflate_paths(const Ref<PolyPaths2D> &p_paths, real_t p_delta) const;
+	Ref<PolyPaths2D> deflate_paths(const Ref<PolyPaths2D> &p_paths, real_t p_delta) const;
+
+	Ref<PolyOffsetCache2D> inflate_polygons_cached(Array p_polygons, real_t p_max_delta) const;
+	Ref<PolyOffsetCache2D> deflate_polygons_cached(Array p_polygons, real_t p_max_delta) const;
+	Ref<PolyOffsetCache2D> deflate_polylines_cached(Array p_polylines, real_t p_max_delta) const;
+
 	_PolyOffset2D() {
 		if (!singleton) {
 			singleton = this;
@@ -74,6 +151,8 @@ protected:
 class PolyOffsetParameters2D : public Resource {
 	GDCLASS(PolyOffsetParameters2D, Resource);
 
+	friend class PolyOffset2D;
+
 public:
 	enum JoinType {
 		JOIN_SQUARE,
@@ -94,6 +173,10 @@ public:
 	real_t arc_tolerance = 0.25;
 	real_t miter_limit = 2.0;
 
+private:
+	// Copy with `end_type` overridden, see `PolyOffset2D::configure()`.
+	Ref<PolyOffsetParameters2D> configured;
+
 protected:
 	static void _bind_methods();
 
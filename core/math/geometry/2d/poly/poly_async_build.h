@@ -0,0 +1,40 @@
+#pragma once
+
+#include "core/os/thread.h"
+
+// Runs builds of nodes on a thread, one at a time. A build requested while
+// another one is running is not started, but restarted by the node once the
+// running build is finished, so that consecutive changes are coalesced.
+class PolyAsyncBuild2D {
+	Thread thread;
+	bool pending = false;
+
+public:
+	// Returns `false` if a build is running, then `is_restart_needed()`
+	// returns `true` once it's finished.
+	bool request() {
+		if (thread.is_started()) {
+			pending = true;
+			return false;
+		}
+		return true;
+	}
+	void start(Thread::Callback p_callback, void *p_userdata) { thread.start(p_callback, p_userdata); }
+	// Waits for the running build, returns `false` if there's none.
+	bool finish() {
+		if (!thread.is_started()) {
+			return false;
+		}
+		thread.wait_to_finish();
+		return true;
+	}
+	bool is_restart_needed() {
+		const bool restart = pending;
+		pending = false;
+		return restart;
+	}
+
+	// Nodes must call `finish()` on destruction, before data used by the build
+	// is destroyed.
+	~PolyAsyncBuild2D() { finish(); }
+};
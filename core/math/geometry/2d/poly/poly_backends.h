@@ -5,14 +5,21 @@
 #include "boolean/poly_boolean.h"
 #include "decomp/poly_decomp.h"
 #include "offset/poly_offset.h"
+#include "poly_work_pool.h"
 
 #include "boolean/clipper10/poly_boolean_clipper10.h"
 #include "boolean/clipper6/poly_boolean_clipper6.h"
+#include "decomp/cdt/poly_decomp_cdt.h"
 #include "decomp/clipper10/poly_decomp_clipper10.h"
 #include "decomp/polypartition/poly_decomp_polypartition.h"
 #include "offset/clipper10/poly_offset_clipper10.h"
 #include "offset/clipper6/poly_offset_clipper6.h"
 
+// Registered backend instances are shared by all threads, so backends must be
+// stateless: per-operation state lives on the stack of each call instead, and
+// everything else is passed via parameters. Parameters may be shared between
+// threads as well, so they are never modified in place once passed, and
+// default parameters are never modified after initialization.
 template <class T>
 class PolyBackend2DManager {
 	struct Backend {
@@ -116,6 +123,10 @@ public:
 	static PolyBackend2DManager<PolyDecomp2DBackend *> poly_decomp;
 
 	static void initialize() {
+		PolyBoolean2D::initialize();
+		PolyOffset2D::initialize();
+		PolyDecomp2D::initialize();
+
 		poly_boolean.setting_name = "goost/geometry/2d/backends/poly_boolean";
 		poly_boolean.register_backend("clipper6", memnew(PolyBoolean2DClipper6), true);
 		poly_boolean.register_backend("clipper10", memnew(PolyBoolean2DClipper10));
@@ -127,7 +138,8 @@ public:
 		poly_decomp.setting_name = "goost/geometry/2d/backends/poly_decomp";
 		poly_decomp.register_backend("polypartition", memnew(PolyDecomp2DPolyPartition));
 		poly_decomp.register_backend("clipper10:polypartition", memnew(PolyDecomp2DClipper10), true);
-		
+		poly_decomp.register_backend("cdt:polypartition", memnew(PolyDecomp2DCDT));
+
 		update();
 	}
 
@@ -141,9 +153,15 @@ public:
 		PolyDecomp2D::set_backend(poly_decomp.get_backend_instance(selected));
 	}
 	static void finalize() {
+		PolyWorkPool2D::finalize();
+
 		poly_boolean.finalize();
 		poly_offset.finalize();
 		poly_decomp.finalize();
+
+		PolyBoolean2D::finalize();
+		PolyOffset2D::finalize();
+		PolyDecomp2D::finalize();
 	}
 };
 
@@ -4,21 +4,6 @@
 
 #include "goost/core/math/geometry/2d/goost_geometry_2d.h"
 
-void draw_polyline_open(PolyNode2D *p_node, const Vector<Point2> &p_polyline, const Color &p_color, real_t p_line_width = 1.0) {
-	ERR_FAIL_COND(p_polyline.size() < 2);
-	for (int i = 0; i < p_polyline.size() - 1; ++i) {
-		p_node->draw_line(p_polyline[i], p_polyline[i + 1], p_color, p_line_width, p_node->is_antialiased());
-	}
-}
-
-void draw_polyline_closed(PolyNode2D *p_node, const Vector<Point2> &p_polyline, const Color &p_color, real_t p_line_width = 1.0) {
-	ERR_FAIL_COND(p_polyline.size() < 3);
-	const int vertices_count = p_polyline.size();
-	for (int i = 0; i < vertices_count; ++i) {
-		p_node->draw_line(p_polyline[i], p_polyline[(i + 1) % vertices_count], p_color, p_line_width, p_node->is_antialiased());
-	}
-}
-
 void PolyNode2D::_draw() {
 	if (parent && operation != OP_NONE) {
 		return;
@@ -26,44 +11,38 @@ void PolyNode2D::_draw() {
 	if (outlines.empty()) {
 		return;
 	}
-	if (open) { // Polylines.
+	if ((open || !filled) && line_width <= 1.0) { // Hairlines, width does not scale with zoom.
 		for (int i = 0; i < outlines.size(); ++i) {
-			if (outlines[i].size() > 1) {
-				draw_polyline_open(this, outlines[i], color, line_width);
+			Vector<Point2> polyline = outlines[i];
+			if (polyline.size() < 2 || (!open && polyline.size() < 3)) {
+				continue;
 			}
-		}
-	} else if (!filled) { // Non-filled polygons.
-		for (int i = 0; i < outlines.size(); ++i) {
-			if (outlines[i].size() >= 3) {
-				draw_polyline_closed(this, outlines[i], color, line_width);
+			if (!open) {
+				polyline.push_back(polyline[0]);
 			}
+			draw_polyline(polyline, color, line_width, antialiased);
 		}
-	} else { // Filled polygons.
-		const Vector<Vector<Point2>> &triangles = PolyDecomp2D::triangulate_polygons(outlines);
-		if (triangles.empty()) {
+	} else if (open || !filled) { // Polylines and non-filled polygons.
+		_update_stroke();
+		if (stroke_indices.empty()) {
 			return;
 		}
-		Vector<Point2> vertices;
-		for (int i = 0; i < triangles.size(); ++i) {
-			const Vector<Point2> &part = triangles[i];
-			for (int j = 0; j < part.size(); ++j) {
-				vertices.push_back(part[j]);
-			}
-		}
-		Vector<Point2> uvs;
-		if (texture.is_valid()) {
-			Transform2D trans(tex_rot, tex_ofs);
-			trans.scale(tex_scale);
-			Size2 tex_size = texture->get_size();
-			uvs.resize(vertices.size());
-			for (int i = 0; i < vertices.size(); ++i) {
-				uvs.write[i] = trans.xform(vertices[i]) / tex_size;
+		Vector<Color> colors;
+		colors.push_back(color);
+
+		// Anti-aliasing would draw lines between vertices of triangles.
+		VS::get_singleton()->canvas_item_add_triangle_array(
+				get_canvas_item(), stroke_indices, stroke_vertices, colors);
+
+		if (antialiased) {
+			for (int i = 0; i < stroke_edges.size(); ++i) {
+				draw_polyline(stroke_edges[i], color, 1.0, true);
 			}
 		}
-		const int indices_count = triangles.size() * 3;
-		Vector<int> indices;
-		for (int i = 0; i < indices_count; ++i) {
-			indices.push_back(i);
+	} else { // Filled polygons.
+		_update_mesh();
+		if (mesh_indices.empty()) {
+			return;
 		}
 		Vector<Color> colors;
 		colors.push_back(color);
@@ -72,9 +51,111 @@ void PolyNode2D::_draw() {
 		RID normal_map_rid = normal_map.is_valid() ? normal_map->get_rid() : RID();
 
 		VS::get_singleton()->canvas_item_add_triangle_array(
-				get_canvas_item(), indices, vertices, colors, uvs,
-				Vector<int>(), Vector<float>(), texture_rid, -1, normal_map_rid, antialiased);
+				get_canvas_item(), mesh_indices, mesh_vertices, colors, mesh_uvs,
+				Vector<int>(), Vector<float>(), texture_rid, -1, normal_map_rid);
+
+		if (antialiased) {
+			// Smooth the edges of polygons instead, like `Polygon2D` does.
+			for (int i = 0; i < outlines.size(); ++i) {
+				Vector<Point2> polyline = outlines[i];
+				if (polyline.size() < 3) {
+					continue;
+				}
+				polyline.push_back(polyline[0]);
+				draw_polyline(polyline, color, 1.0, true);
+			}
+		}
+	}
+}
+
+void PolyNode2D::_update_stroke() {
+	if (!stroke_dirty) {
+		return;
+	}
+	stroke_vertices.clear();
+	stroke_indices.clear();
+	stroke_edges.clear();
+	for (int i = 0; i < outlines.size(); ++i) {
+		const int base = stroke_vertices.size();
+		GoostGeometry2D::stroke_polyline(outlines[i], line_width, !open, stroke_vertices, stroke_indices);
+
+		// Vertices alternate between both sides of the polyline.
+		const int count = (stroke_vertices.size() - base) / 2;
+		if (count == 0) {
+			continue;
+		}
+		const Point2 *v = stroke_vertices.ptr() + base;
+		Vector<Point2> left;
+		Vector<Point2> right;
+		for (int j = 0; j < count; ++j) {
+			left.push_back(v[j * 2]);
+			right.push_back(v[j * 2 + 1]);
+		}
+		if (open) { // Single outline around the stroke.
+			for (int j = count - 1; j >= 0; --j) {
+				left.push_back(right[j]);
+			}
+			left.push_back(left[0]);
+			stroke_edges.push_back(left);
+		} else {
+			left.push_back(left[0]);
+			right.push_back(right[0]);
+			stroke_edges.push_back(left);
+			stroke_edges.push_back(right);
+		}
 	}
+	stroke_dirty = false;
+}
+
+void PolyNode2D::_update_mesh() {
+	if (mesh_dirty) {
+		mesh_vertices.clear();
+		mesh_indices.clear();
+
+		const Vector<Vector<Point2>> &triangles = PolyDecomp2D::triangulate_polygons(outlines);
+		mesh_indices.resize(triangles.size() * 3);
+		int *indices = mesh_indices.ptrw();
+		int index_count = 0;
+
+		// Triangles produced from the same outlines share vertices exactly.
+		Map<Point2, int> vertex_map;
+		for (int i = 0; i < triangles.size(); ++i) {
+			const Vector<Point2> &tri = triangles[i];
+			if (tri.size() != 3) {
+				continue;
+			}
+			for (int j = 0; j < 3; ++j) {
+				Map<Point2, int>::Element *E = vertex_map.find(tri[j]);
+				if (!E) {
+					E = vertex_map.insert(tri[j], mesh_vertices.size());
+					mesh_vertices.push_back(tri[j]);
+				}
+				indices[index_count++] = E->get();
+			}
+		}
+		mesh_indices.resize(index_count);
+		mesh_dirty = false;
+		mesh_uvs_dirty = true;
+	}
+	if (texture.is_null()) {
+		mesh_uvs.clear();
+		return;
+	}
+	const Size2 tex_size = texture->get_size();
+	if (!mesh_uvs_dirty && tex_size == mesh_uvs_texture_size) {
+		return;
+	}
+	Transform2D trans(tex_rot, tex_ofs);
+	trans.scale(tex_scale);
+
+	mesh_uvs.resize(mesh_vertices.size());
+	const Point2 *vertices = mesh_vertices.ptr();
+	Point2 *uvs = mesh_uvs.ptrw();
+	for (int i = 0; i < mesh_vertices.size(); ++i) {
+		uvs[i] = trans.xform(vertices[i]) / tex_size;
+	}
+	mesh_uvs_texture_size = tex_size;
+	mesh_uvs_dirty = false;
 }
 
 void PolyNode2D::_notification(int p_what) {
@@ -82,7 +163,14 @@ void PolyNode2D::_notification(int p_what) {
 		case NOTIFICATION_ENTER_TREE:
 		case NOTIFICATION_PARENTED: {
 			parent = Object::cast_to<PolyNode2D>(get_parent());
-			_queue_update();
+			_propagate_update();
+		} break;
+		case NOTIFICATION_UNPARENTED: {
+			// Still listed among children of the parent at this point.
+			if (parent) {
+				parent->_child_changed(this);
+			}
+			parent = nullptr;
 		} break;
 		case NOTIFICATION_DRAW: {
 			if (!is_inside_tree()) {
@@ -92,19 +180,43 @@ void PolyNode2D::_notification(int p_what) {
 		} break;
 		case NOTIFICATION_LOCAL_TRANSFORM_CHANGED:
 		case NOTIFICATION_VISIBILITY_CHANGED:
+		case NOTIFICATION_MOVED_IN_PARENT:
 		case NOTIFICATION_EXIT_TREE: {
-			_queue_update();
+			// Own outlines are unaffected, but the parent has to reapply them.
+			_propagate_update();
 		} break;
 	}
 }
 
 void PolyNode2D::_queue_update() {
+	base_dirty = true;
+	_propagate_update();
+}
+
+void PolyNode2D::_child_changed(const PolyNode2D *p_child) {
+	const ObjectID id = p_child->get_instance_id();
+	for (int i = 0; i < MIN(dirty_step, child_steps.size()); ++i) {
+		if (child_steps[i].id == id) {
+			dirty_step = i;
+			break;
+		}
+	}
+	// Steps of newly added or reordered children are invalidated on rebuild.
+	_propagate_update();
+}
+
+void PolyNode2D::_propagate_update() {
+	// Caches are invalidated even outside of the tree, so that outlines built
+	// manually are up to date as well.
+	outlines_dirty = true;
+	++revision;
+	if (parent) {
+		parent->_child_changed(this);
+	}
 	if (!is_inside_tree()) {
 		return;
 	}
-	if (parent) {
-		parent->_queue_update();
-	} else if (!update_queued) {
+	if (!parent && !update_queued) {
 		call_deferred("_update_outlines");
 	}
 	update_queued = true;
@@ -139,50 +251,94 @@ Vector<Vector<Point2>> PolyNode2D::_build_outlines() {
 }
 
 Vector<Vector<Point2>> PolyNode2D::get_outlines() {
-	if (!update_queued) {
+	if (!outlines_dirty) {
 		return outlines;
 	}
+	if (async_build && !parent && is_inside_tree()) {
+		return outlines; // Previous outlines are kept until new ones are built.
+	}
 	return build_outlines();
 }
 
+Vector<Vector<Point2>> PolyNode2D::_apply_operation(const Vector<Vector<Point2>> &p_outlines, bool p_open,
+		const Vector<Vector<Point2>> &p_clip_outlines, const Transform2D &p_clip_transform, Operation p_clip_operation, bool p_clip_open) {
+	if (p_clip_outlines.empty()) {
+		return p_outlines;
+	}
+	if (p_outlines.empty()) {
+		return copy_outlines(p_clip_outlines, p_clip_transform);
+	}
+	if (p_clip_operation == OP_NONE) {
+		return p_outlines;
+	}
+	const Vector<Vector<Point2>> &clip_outlines = copy_outlines(p_clip_outlines, p_clip_transform);
+	auto op = PolyBoolean2D::Operation(p_clip_operation);
+
+	if (p_open && !p_clip_open) { // Polylines vs Polygons.
+		switch (op) {
+			case PolyBoolean2D::OP_DIFFERENCE: {
+				return PolyBoolean2D::clip_polylines_with_polygons(p_outlines, clip_outlines);
+			} break;
+			case PolyBoolean2D::OP_INTERSECTION: {
+				return PolyBoolean2D::intersect_polylines_with_polygons(p_outlines, clip_outlines);
+			} break;
+			default: {
+				WARN_PRINT("Union and Xor operations are not supported for polyline vs polygon");
+			}
+		}
+		return p_outlines;
+	}
+	// Polygons vs Polygons.
+	return PolyBoolean2D::boolean_polygons(p_outlines, clip_outlines, op);
+}
+
+Vector<Vector<Point2>> PolyNode2D::_apply_child(const Vector<Vector<Point2>> &p_outlines, PolyNode2D *p_child) const {
+	if (!p_child->is_visible_in_tree()) {
+		return p_outlines;
+	}
+	return _apply_operation(p_outlines, open, p_child->get_outlines(), p_child->get_transform(), p_child->operation, p_child->open);
+}
+
 Vector<Vector<Point2>> PolyNode2D::build_outlines() {
-	outlines = _build_outlines();
+	if (base_dirty) {
+		base_outlines = _build_outlines();
+		base_dirty = false;
+		dirty_step = 0;
+	}
+	outlines = base_outlines;
 
+	int step = 0;
 	for (int i = 0; i < get_child_count(); ++i) {
 		PolyNode2D *clip = Object::cast_to<PolyNode2D>(get_child(i));
 		if (!clip) {
 			continue;
 		}
-		if (!clip->is_visible_in_tree()) {
+		const ObjectID id = clip->get_instance_id();
+		if (step < dirty_step && step < child_steps.size() && child_steps[step].id == id) {
+			outlines = child_steps[step].outlines; // Not affected by changes.
+			++step;
 			continue;
 		}
-		Vector<Vector<Point2>> clip_outlines = clip->get_outlines();
-		if (clip_outlines.empty()) {
-			continue;
-		}
-		if (outlines.empty()) {
-			outlines = copy_outlines(clip_outlines, clip->get_transform());
-		} else if (clip->operation != OP_NONE) {
-			clip_outlines = copy_outlines(clip_outlines, clip->get_transform());
-			auto op = PolyBoolean2D::Operation(clip->operation);
-
-			if (open && !clip->open) { // Polylines vs Polygons.
-				switch (op) {
-					case PolyBoolean2D::OP_DIFFERENCE: {
-						outlines = PolyBoolean2D::clip_polylines_with_polygons(outlines, clip_outlines);
-					} break;
-					case PolyBoolean2D::OP_INTERSECTION: {
-						outlines = PolyBoolean2D::intersect_polylines_with_polygons(outlines, clip_outlines);
-					} break;
-					default: {
-						WARN_PRINT("Union and Xor operations are not supported for polyline vs polygon");
-					}
-				}
-			} else { // Polygons vs Polygons.
-				outlines = PolyBoolean2D::boolean_polygons(outlines, clip_outlines, op);
-			}
+		// All subsequent steps depend on this one, so have to be recomputed.
+		dirty_step = step;
+		outlines = _apply_child(outlines, clip);
+
+		ChildStep cs;
+		cs.id = id;
+		cs.outlines = outlines;
+		if (step < child_steps.size()) {
+			child_steps.write[step] = cs;
+		} else {
+			child_steps.push_back(cs);
 		}
+		++step;
 	}
+	child_steps.resize(step);
+	dirty_step = step;
+	mesh_dirty = true;
+	stroke_dirty = true;
+
+	outlines_dirty = false;
 	update_queued = false;
 
 	return outlines;
@@ -192,11 +348,136 @@ void PolyNode2D::_update_outlines() {
 	if (parent) {
 		return;
 	}
+	if (async_build && is_inside_tree()) {
+		update_queued = false;
+		if (async_builder.request()) {
+			_start_async_build();
+		}
+		return;
+	}
 	get_outlines();
 	update();
 	emit_signal("outlines_updated");
 }
 
+int PolyNode2D::_take_snapshot(Vector<BuildNode> &r_snapshot) {
+	if (base_dirty) {
+		base_outlines = _build_outlines();
+		base_dirty = false;
+		dirty_step = 0;
+	}
+	BuildNode node;
+	node.id = get_instance_id();
+	node.revision = revision;
+	node.transform = get_transform();
+	node.operation = operation;
+	node.open = open;
+	node.visible = is_visible_in_tree();
+	node.dirty = outlines_dirty;
+	node.base_outlines = base_outlines;
+	node.child_steps = child_steps;
+	node.dirty_step = dirty_step;
+	node.outlines = outlines;
+
+	const int index = r_snapshot.size();
+	r_snapshot.push_back(node);
+
+	if (!node.visible && parent) {
+		return index; // Not applied to the parent anyway.
+	}
+	for (int i = 0; i < get_child_count(); ++i) {
+		PolyNode2D *clip = Object::cast_to<PolyNode2D>(get_child(i));
+		if (!clip) {
+			continue;
+		}
+		const int child_index = clip->_take_snapshot(r_snapshot);
+		r_snapshot.write[index].children.push_back(child_index);
+	}
+	return index;
+}
+
+// Same as `build_outlines()`, but only operates on the snapshot.
+void PolyNode2D::_build_snapshot(BuildNode *r_nodes, int p_index) {
+	BuildNode &node = r_nodes[p_index];
+	Vector<Vector<Point2>> outlines = node.base_outlines;
+
+	int step = 0;
+	for (int i = 0; i < node.children.size(); ++i) {
+		BuildNode &clip = r_nodes[node.children[i]];
+		if (step < node.dirty_step && step < node.child_steps.size() && node.child_steps[step].id == clip.id) {
+			outlines = node.child_steps[step].outlines;
+			++step;
+			continue;
+		}
+		node.dirty_step = step;
+		if (clip.visible) {
+			if (clip.dirty) {
+				_build_snapshot(r_nodes, node.children[i]);
+			}
+			outlines = _apply_operation(outlines, node.open, clip.outlines, clip.transform, clip.operation, clip.open);
+		}
+		ChildStep cs;
+		cs.id = clip.id;
+		cs.outlines = outlines;
+		if (step < node.child_steps.size()) {
+			node.child_steps.write[step] = cs;
+		} else {
+			node.child_steps.push_back(cs);
+		}
+		++step;
+	}
+	node.child_steps.resize(step);
+	node.dirty_step = step;
+	node.outlines = outlines;
+	node.built = true;
+}
+
+void PolyNode2D::_async_build(void *p_userdata) {
+	PolyNode2D *root = static_cast<PolyNode2D *>(p_userdata);
+	_build_snapshot(root->async_snapshot.ptrw(), 0);
+	root->call_deferred("_finish_async_build");
+}
+
+void PolyNode2D::_start_async_build() {
+	async_snapshot.clear();
+	_take_snapshot(async_snapshot);
+	async_builder.start(_async_build, this);
+}
+
+void PolyNode2D::_finish_async_build() {
+	if (!async_builder.finish()) {
+		return;
+	}
+	for (int i = 0; i < async_snapshot.size(); ++i) {
+		const BuildNode &bn = async_snapshot[i];
+		if (!bn.built) {
+			continue;
+		}
+		PolyNode2D *n = Object::cast_to<PolyNode2D>(ObjectDB::get_instance(bn.id));
+		if (!n) {
+			continue; // Freed while building.
+		}
+		if (n->revision == bn.revision) {
+			// Not modified while building, so the result is up to date.
+			n->child_steps = bn.child_steps;
+			n->dirty_step = bn.dirty_step;
+			n->outlines_dirty = false;
+		} else if (!n->outlines_dirty) {
+			continue; // Already rebuilt synchronously, the result is outdated.
+		}
+		n->outlines = bn.outlines;
+		n->mesh_dirty = true;
+		n->stroke_dirty = true;
+		n->update();
+	}
+	async_snapshot.clear();
+	emit_signal("outlines_updated");
+
+	if (async_builder.is_restart_needed()) {
+		_update_outlines();
+	}
+}
+
 void PolyNode2D::_validate_property(PropertyInfo &property) const {
 	if (property.name == "filled") {
 		if (open) {
@@ -217,7 +498,7 @@ void PolyNode2D::set_points(const Vector<Point2> &p_points) {
 
 void PolyNode2D::set_operation(Operation p_operation) {
 	operation = p_operation;
-	_queue_update();
+	_propagate_update();
 }
 
 void PolyNode2D::set_open(bool p_open) {
@@ -228,6 +509,7 @@ void PolyNode2D::set_open(bool p_open) {
 
 void PolyNode2D::set_texture(const Ref<Texture> &p_texture) {
 	texture = p_texture;
+	mesh_uvs_dirty = true;
 	update();
 }
 
@@ -238,11 +520,13 @@ void PolyNode2D::set_normal_map(const Ref<Texture> &p_texture) {
 
 void PolyNode2D::set_texture_offset(const Vector2 &p_offset) {
 	tex_ofs = p_offset;
+	mesh_uvs_dirty = true;
 	update();
 }
 
 void PolyNode2D::set_texture_rotation(float p_rot) {
 	tex_rot = p_rot;
+	mesh_uvs_dirty = true;
 	update();
 }
 
@@ -257,6 +541,7 @@ float PolyNode2D::get_texture_rotation_degrees() const {
 
 void PolyNode2D::set_texture_scale(const Size2 &p_scale) {
 	tex_scale = p_scale;
+	mesh_uvs_dirty = true;
 	update();
 }
 
@@ -273,6 +558,7 @@ void PolyNode2D::set_filled(bool p_filled) {
 
 void PolyNode2D::set_line_width(real_t p_line_width) {
 	line_width = p_line_width;
+	stroke_dirty = true;
 	update();
 }
 
@@ -281,6 +567,10 @@ void PolyNode2D::set_antialiased(bool p_antialiased) {
 	update();
 }
 
+void PolyNode2D::set_async_build(bool p_async_build) {
+	async_build = p_async_build;
+}
+
 PolyNode2D *PolyNode2D::new_child(const Vector<Point2> &p_points) {
 	PolyNode2D *child = memnew(PolyNode2D);
 	child->points = p_points;
@@ -328,6 +618,7 @@ void PolyNode2D::make_from_outlines(const Array &p_outlines) {
 }
 
 Array PolyNode2D::get_outlines_array() {
+	get_outlines();
 	Array ret;
 	for (int i = 0; i < outlines.size(); ++i) {
 		ret.push_back(outlines[i]);
@@ -354,6 +645,7 @@ void PolyNode2D::clear() {
 		}
 	}
 	points = Vector<Point2>();
+	_queue_update();
 }
 
 void PolyNode2D::_bind_methods() {
@@ -396,6 +688,9 @@ void PolyNode2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_antialiased", "antialiased"), &PolyNode2D::set_antialiased);
 	ClassDB::bind_method(D_METHOD("is_antialiased"), &PolyNode2D::is_antialiased);
 
+	ClassDB::bind_method(D_METHOD("set_async_build", "async_build"), &PolyNode2D::set_async_build);
+	ClassDB::bind_method(D_METHOD("is_async_build"), &PolyNode2D::is_async_build);
+
 	ClassDB::bind_method(D_METHOD("new_child", "from_points"), &PolyNode2D::new_child);
 
 	ClassDB::bind_method(D_METHOD("is_inner"), &PolyNode2D::is_inner);
@@ -408,11 +703,13 @@ void PolyNode2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("clear"), &PolyNode2D::clear);
 
 	ClassDB::bind_method(D_METHOD("_update_outlines"), &PolyNode2D::_update_outlines);
+	ClassDB::bind_method(D_METHOD("_finish_async_build"), &PolyNode2D::_finish_async_build);
 	ClassDB::bind_method(D_METHOD("_queue_update"), &PolyNode2D::_queue_update);
 
 	ADD_PROPERTY(PropertyInfo(Variant::POOL_VECTOR2_ARRAY, "points"), "set_points", "get_points");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "operation", PROPERTY_HINT_ENUM, "None,Union,Difference,Intersection,Xor"), "set_operation", "get_operation");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "open"), "set_open", "is_open");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "async_build"), "set_async_build", "is_async_build");
 
 	ADD_GROUP("Textures", "");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "texture", PROPERTY_HINT_RESOURCE_TYPE, "Texture"), "set_texture", "get_texture");
@@ -495,3 +792,7 @@ bool PolyNode2D::_edit_is_selected_on_click(const Point2 &p_point, double p_tole
 PolyNode2D::PolyNode2D() {
 	set_notify_local_transform(true);
 }
+
+PolyNode2D::~PolyNode2D() {
+	async_builder.finish(); // Before the snapshot it builds is destroyed.
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "poly_async_build.h"
 #include "scene/2d/node_2d.h"
 
 class PolyNode2D : public Node2D {
@@ -36,6 +37,72 @@ private:
 	PolyNode2D *parent = nullptr;
 	bool update_queued = false;
 
+	// Outlines are rebuilt incrementally: the result of applying each child's
+	// operation is cached, so only the steps starting from the first changed
+	// child have to be recomputed.
+	struct ChildStep {
+		ObjectID id;
+		Vector<Vector<Point2>> outlines;
+	};
+	Vector<ChildStep> child_steps;
+	int dirty_step = 0; // Index of the first cached step which is no longer valid.
+	Vector<Vector<Point2>> base_outlines; // As returned by `_build_outlines()`.
+	bool base_dirty = true;
+	bool outlines_dirty = true;
+
+	// Triangulated outlines for drawing filled polygons, regenerated only if
+	// outlines change. Vertices are shared between triangles.
+	Vector<Point2> mesh_vertices;
+	Vector<int> mesh_indices;
+	bool mesh_dirty = true;
+	Vector<Point2> mesh_uvs;
+	Size2 mesh_uvs_texture_size;
+	bool mesh_uvs_dirty = true;
+	void _update_mesh();
+
+	// Polylines and non-filled polygons wider than a hairline are drawn as a
+	// single stroke mesh, with antialiased hairlines along its edges.
+	Vector<Point2> stroke_vertices;
+	Vector<int> stroke_indices;
+	Vector<Vector<Point2>> stroke_edges;
+	bool stroke_dirty = true;
+	void _update_stroke();
+
+	void _child_changed(const PolyNode2D *p_child);
+	void _propagate_update();
+	uint64_t revision = 0; // Incremented whenever outlines of this node are invalidated.
+
+	static Vector<Vector<Point2>> _apply_operation(const Vector<Vector<Point2>> &p_outlines, bool p_open,
+			const Vector<Vector<Point2>> &p_clip_outlines, const Transform2D &p_clip_transform, Operation p_clip_operation, bool p_clip_open);
+	Vector<Vector<Point2>> _apply_child(const Vector<Vector<Point2>> &p_outlines, PolyNode2D *p_child) const;
+
+	// Outlines can be built on a thread from a snapshot of the hierarchy taken
+	// on the main thread, so that nodes can be modified while building.
+	struct BuildNode {
+		ObjectID id;
+		uint64_t revision = 0;
+		Transform2D transform;
+		Operation operation = OP_UNION;
+		bool open = false;
+		bool visible = true;
+		bool dirty = true;
+		Vector<Vector<Point2>> base_outlines;
+		Vector<ChildStep> child_steps;
+		int dirty_step = 0;
+		Vector<int> children; // Indices of children in the snapshot.
+		Vector<Vector<Point2>> outlines; // Current, replaced with new ones when built.
+		bool built = false;
+	};
+	bool async_build = false;
+	PolyAsyncBuild2D async_builder;
+	Vector<BuildNode> async_snapshot;
+
+	int _take_snapshot(Vector<BuildNode> &r_snapshot);
+	static void _build_snapshot(BuildNode *r_nodes, int p_index);
+	static void _async_build(void *p_userdata);
+	void _start_async_build();
+	void _finish_async_build();
+
 protected:
 	void _notification(int p_what);
 	virtual void _validate_property(PropertyInfo &property) const;
@@ -87,6 +154,9 @@ public:
 	void set_antialiased(bool p_antialiased);
 	bool is_antialiased() const { return antialiased; }
 
+	void set_async_build(bool p_async_build);
+	bool is_async_build() const { return async_build; }
+
 	PolyNode2D *new_child(const Vector<Point2> &p_points);
 	bool is_inner() const;
 	bool is_root() const { return !parent; }
@@ -105,6 +175,7 @@ public:
 	virtual bool _edit_is_selected_on_click(const Point2 &p_point, double p_tolerance) const;
 #endif
 	PolyNode2D();
+	~PolyNode2D();
 };
 
 VARIANT_ENUM_CAST(PolyNode2D::Operation);
@@ -0,0 +1,49 @@
+#include "poly_paths_2d.h"
+#include "utils/godot_clipper10_path_convert.h"
+
+void PolyPaths2D::scale_up_polypaths(const Vector<Vector<Point2>> &p_polypaths_in, clipperlib::Paths &p_polypaths_out) {
+	GodotClipperUtils::scale_up_polypaths(p_polypaths_in, p_polypaths_out);
+}
+
+void PolyPaths2D::scale_down_polypaths(const clipperlib::Paths &p_polypaths_in, Vector<Vector<Point2>> &p_polypaths_out) {
+	GodotClipperUtils::scale_down_polypaths(p_polypaths_in, p_polypaths_out);
+}
+
+void PolyPaths2D::set_polypaths(const Vector<Vector<Point2>> &p_polypaths) {
+	scale_up_polypaths(p_polypaths, paths);
+}
+
+Vector<Vector<Point2>> PolyPaths2D::get_polypaths() const {
+	Vector<Vector<Point2>> polypaths;
+	scale_down_polypaths(paths, polypaths);
+	return polypaths;
+}
+
+void PolyPaths2D::set_polypaths_array(const Array &p_polypaths) {
+	Vector<Vector<Point2>> polypaths;
+	polypaths.resize(p_polypaths.size());
+	for (int i = 0; i < p_polypaths.size(); ++i) {
+		polypaths.write[i] = p_polypaths[i];
+	}
+	set_polypaths(polypaths);
+}
+
+Array PolyPaths2D::get_polypaths_array() const {
+	const Vector<Vector<Point2>> &polypaths = get_polypaths();
+	Array ret;
+	for (int i = 0; i < polypaths.size(); ++i) {
+		ret.push_back(polypaths[i]);
+	}
+	return ret;
+}
+
+void PolyPaths2D::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_polypaths", "polypaths"), &PolyPaths2D::set_polypaths_array);
+	ClassDB::bind_method(D_METHOD("get_polypaths"), &PolyPaths2D::get_polypaths_array);
+
+	ClassDB::bind_method(D_METHOD("get_path_count"), &PolyPaths2D::get_path_count);
+	ClassDB::bind_method(D_METHOD("is_empty"), &PolyPaths2D::is_empty);
+	ClassDB::bind_method(D_METHOD("clear"), &PolyPaths2D::clear);
+
+	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "polypaths"), "set_polypaths", "get_polypaths");
+}
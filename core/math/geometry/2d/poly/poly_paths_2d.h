@@ -0,0 +1,34 @@
+#pragma once
+
+#include "core/reference.h"
+#include "goost/thirdparty/clipper/clipper.h"
+
+// Polygons or polylines stored in fixed-point integer coordinates (scaled by
+// `SCALE_FACTOR`), which is the native representation of Clipper backends.
+// Allows to chain operations without converting from and to floating-point
+// coordinates in-between.
+class PolyPaths2D : public Reference {
+	GDCLASS(PolyPaths2D, Reference);
+
+	clipperlib::Paths paths;
+
+protected:
+	static void _bind_methods();
+
+public:
+	static void scale_up_polypaths(const Vector<Vector<Point2>> &p_polypaths_in, clipperlib::Paths &p_polypaths_out);
+	static void scale_down_polypaths(const clipperlib::Paths &p_polypaths_in, Vector<Vector<Point2>> &p_polypaths_out);
+
+	void set_polypaths(const Vector<Vector<Point2>> &p_polypaths);
+	Vector<Vector<Point2>> get_polypaths() const;
+
+	void set_polypaths_array(const Array &p_polypaths);
+	Array get_polypaths_array() const;
+
+	int get_path_count() const { return paths.size(); }
+	bool is_empty() const { return paths.empty(); }
+	void clear() { paths.clear(); }
+
+	clipperlib::Paths &get_paths() { return paths; }
+	const clipperlib::Paths &get_paths() const { return paths; }
+};
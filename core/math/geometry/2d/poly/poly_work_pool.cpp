@@ -0,0 +1,14 @@
+#include "poly_work_pool.h"
+
+ThreadWorkPool *PolyWorkPool2D::pool = nullptr;
+Mutex PolyWorkPool2D::mutex;
+
+void PolyWorkPool2D::finalize() {
+	mutex.lock();
+	if (pool) {
+		pool->finish();
+		memdelete(pool);
+		pool = nullptr;
+	}
+	mutex.unlock();
+}
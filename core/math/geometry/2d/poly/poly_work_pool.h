@@ -0,0 +1,34 @@
+#pragma once
+
+#include "core/os/mutex.h"
+#include "core/os/os.h"
+#include "core/os/thread_work_pool.h"
+
+// Worker threads shared by batch operations, started on first use and kept
+// until `finalize()`, so that batches don't start and join threads on every
+// call. Only one batch runs on the threads at a time: while they are busy
+// (with a batch started on another thread, or from a job of another batch),
+// elements are processed on the calling thread instead.
+class PolyWorkPool2D {
+	static ThreadWorkPool *pool;
+	static Mutex mutex;
+
+public:
+	template <class C, class M, class U>
+	static void do_work(uint32_t p_elements, C p_instance, M p_method, U p_userdata) {
+		if (p_elements > 1 && OS::get_singleton()->get_processor_count() > 1 && mutex.try_lock() == OK) {
+			if (!pool) {
+				pool = memnew(ThreadWorkPool);
+				pool->init();
+			}
+			pool->do_work(p_elements, p_instance, p_method, p_userdata);
+			mutex.unlock();
+			return;
+		}
+		for (uint32_t i = 0; i < p_elements; ++i) {
+			(p_instance->*p_method)(i, p_userdata);
+		}
+	}
+
+	static void finalize();
+};
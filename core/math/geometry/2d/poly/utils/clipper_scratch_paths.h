@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+
+// Fixed-point paths which Clipper backends convert the input into. The storage
+// is declared `static thread_local` by each backend and kept between
+// consecutive operations on the same thread (such as the chain of clips done
+// by `PolyNode2D`). Path conversion in `GodotClipperUtils` resizes output paths
+// rather than clearing them, so it reuses the capacity of previous paths
+// instead of allocating, and converts with plain loops over contiguous memory
+// which compilers are able to vectorize. Once the scratch object goes out of scope, storage
+// which grew beyond `MAX_POINTS` is released, so that a single large operation
+// does not keep its peak allocation for the lifetime of the thread, including
+// worker threads.
+template <typename TPaths>
+class ClipperScratchPaths {
+	TPaths &paths;
+
+public:
+	static const size_t MAX_POINTS = 1 << 16;
+
+	TPaths &get() { return paths; }
+
+	explicit ClipperScratchPaths(TPaths &p_storage) :
+			paths(p_storage) {}
+
+	~ClipperScratchPaths() {
+		size_t points = 0;
+		for (size_t i = 0; i < paths.size(); ++i) {
+			points += paths[i].capacity();
+		}
+		if (points > MAX_POINTS || paths.capacity() > MAX_POINTS) {
+			TPaths().swap(paths);
+		}
+	}
+};
@@ -7,54 +7,75 @@ namespace GodotClipperUtils {
 using namespace ClipperLib;
 
 void scale_up_polypaths(const Vector<Vector<Point2>> &p_polypaths_in, Paths &p_polypaths_out) {
-	p_polypaths_out.clear();
 	p_polypaths_out.resize(p_polypaths_in.size());
 
 	for (int i = 0; i < p_polypaths_in.size(); ++i) {
-		const Vector<Point2> &polypath_in = p_polypaths_in[i];
-		Path &polypath_out = p_polypaths_out[i];
-
-		for (int j = 0; j < polypath_in.size(); ++j) {
-			polypath_out << IntPoint(
-					polypath_in[j].x * SCALE_FACTOR,
-					polypath_in[j].y * SCALE_FACTOR);
-		}
+		scale_up_polypath(p_polypaths_in[i], p_polypaths_out[i]);
 	}
 }
 
 void scale_down_polypaths(const Paths &p_polypaths_in, Vector<Vector<Point2>> &p_polypaths_out) {
-	p_polypaths_out.clear();
+	p_polypaths_out.resize(p_polypaths_in.size());
+	Vector<Point2> *polypaths_out = p_polypaths_out.ptrw();
 
 	for (Paths::size_type i = 0; i < p_polypaths_in.size(); ++i) {
-		const Path &polypath_in = p_polypaths_in[i];
-		Vector<Vector2> polypath_out;
-
-		for (Paths::size_type j = 0; j < polypath_in.size(); ++j) {
-			polypath_out.push_back(Point2(
-					static_cast<real_t>(polypath_in[j].X) / SCALE_FACTOR,
-					static_cast<real_t>(polypath_in[j].Y) / SCALE_FACTOR));
-		}
-		p_polypaths_out.push_back(polypath_out);
+		scale_down_polypath(p_polypaths_in[i], polypaths_out[i]);
 	}
 }
 
 void scale_up_polypath(const Vector<Point2> &p_polypath_in, Path &p_polypath_out) {
-	p_polypath_out.clear();
+	const int size = p_polypath_in.size();
+	p_polypath_out.resize(size);
 
-	for (int i = 0; i < p_polypath_in.size(); ++i) {
-		p_polypath_out << IntPoint(
-				p_polypath_in[i].x * SCALE_FACTOR,
-				p_polypath_in[i].y * SCALE_FACTOR);
+	const Point2 *r = p_polypath_in.ptr();
+	IntPoint *w = p_polypath_out.data();
+
+	for (int i = 0; i < size; ++i) {
+		w[i].X = static_cast<cInt>(r[i].x * SCALE_FACTOR);
+		w[i].Y = static_cast<cInt>(r[i].y * SCALE_FACTOR);
 	}
 }
 
 void scale_down_polypath(const Path &p_polypath_in, Vector<Point2> &p_polypath_out) {
-	p_polypath_out.clear();
+	const int size = p_polypath_in.size();
+	p_polypath_out.resize(size);
+
+	const IntPoint *r = p_polypath_in.data();
+	Point2 *w = p_polypath_out.ptrw();
+
+	for (int i = 0; i < size; ++i) {
+		w[i].x = static_cast<real_t>(r[i].X) / SCALE_FACTOR;
+		w[i].y = static_cast<real_t>(r[i].Y) / SCALE_FACTOR;
+	}
+}
+
+void copy_polypaths(const clipperlib::Paths &p_polypaths_in, Paths &p_polypaths_out) {
+	p_polypaths_out.resize(p_polypaths_in.size());
 
-	for (Path::size_type i = 0; i < p_polypath_in.size(); ++i) {
-		p_polypath_out.push_back(Point2(
-				static_cast<real_t>(p_polypath_in[i].X) / SCALE_FACTOR,
-				static_cast<real_t>(p_polypath_in[i].Y) / SCALE_FACTOR));
+	for (Paths::size_type i = 0; i < p_polypaths_in.size(); ++i) {
+		const clipperlib::Path &polypath_in = p_polypaths_in[i];
+		Path &polypath_out = p_polypaths_out[i];
+		polypath_out.resize(polypath_in.size());
+
+		for (Path::size_type j = 0; j < polypath_in.size(); ++j) {
+			polypath_out[j].X = polypath_in[j].x;
+			polypath_out[j].Y = polypath_in[j].y;
+		}
+	}
+}
+
+void copy_polypaths(const Paths &p_polypaths_in, clipperlib::Paths &p_polypaths_out) {
+	p_polypaths_out.resize(p_polypaths_in.size());
+
+	for (Paths::size_type i = 0; i < p_polypaths_in.size(); ++i) {
+		const Path &polypath_in = p_polypaths_in[i];
+		clipperlib::Path &polypath_out = p_polypaths_out[i];
+		polypath_out.resize(polypath_in.size());
+
+		for (Path::size_type j = 0; j < polypath_in.size(); ++j) {
+			polypath_out[j].x = polypath_in[j].X;
+			polypath_out[j].y = polypath_in[j].Y;
+		}
 	}
 }
 
@@ -2,6 +2,7 @@
 
 #include "core/math/vector2.h"
 #include "core/vector.h"
+#include "goost/thirdparty/clipper/clipper.h"
 #include "thirdparty/misc/clipper.hpp"
 
 // Note: we provide a complete type for LocalMinimum as Clipper 6.4.2 only
@@ -23,5 +24,9 @@ void scale_down_polypaths(const Paths &p_polypaths_in, Vector<Vector<Point2>> &p
 void scale_up_polypath(const Vector<Point2> &p_polypath_in, Path &p_polypath_out);
 void scale_down_polypath(const Path &p_polypath_in, Vector<Point2> &p_polypath_out);
 
+// Both Clipper versions use 64-bit integer coordinates, so no scaling is done.
+void copy_polypaths(const clipperlib::Paths &p_polypaths_in, Paths &p_polypaths_out);
+void copy_polypaths(const Paths &p_polypaths_in, clipperlib::Paths &p_polypaths_out);
+
 } // namespace GodotClipperUtils
 
@@ -0,0 +1,250 @@
+#include "poly_index_2d.h"
+
+#include "core/sort_array.h"
+#include "goost_geometry_2d.h"
+
+static const int BVH_LEAF_SIZE = 4;
+static const int BVH_MAX_DEPTH = 64;
+static const int MAX_SLAB_COUNT = 512;
+
+// Unlike `Rect2::has_point()`, points on the right and bottom borders are
+// included too, since points on the boundary of a polygon count as inside.
+static _FORCE_INLINE_ bool _rect_has_point(const Rect2 &p_rect, const Point2 &p_point) {
+	return p_point.x >= p_rect.position.x && p_point.y >= p_rect.position.y &&
+			p_point.x <= p_rect.position.x + p_rect.size.x && p_point.y <= p_rect.position.y + p_rect.size.y;
+}
+
+// Clamped before conversion, as the offset of points far away from a thin
+// polygon may not fit into `int`.
+static _FORCE_INLINE_ int _slab_of(real_t p_y, real_t p_top, real_t p_slab_height, int p_slab_count) {
+	if (p_slab_count == 1) {
+		return 0;
+	}
+	return int(CLAMP((p_y - p_top) / p_slab_height, 0.0, real_t(p_slab_count - 1)));
+}
+
+struct _PolyIndex2DCenterSort {
+	const Point2 *centers = nullptr;
+	int axis = 0;
+
+	bool operator()(int p_a, int p_b) const {
+		return centers[p_a][axis] < centers[p_b][axis];
+	}
+};
+
+void PolyIndex2D::set_polygons(const Vector<Vector<Point2>> &p_polygons) {
+	polygons = p_polygons;
+	_build();
+	emit_changed();
+}
+
+void PolyIndex2D::set_polygons_array(const Array &p_polygons) {
+	Vector<Vector<Point2>> polys;
+	polys.resize(p_polygons.size());
+	for (int i = 0; i < p_polygons.size(); ++i) {
+		polys.write[i] = p_polygons[i];
+	}
+	set_polygons(polys);
+}
+
+Array PolyIndex2D::get_polygons_array() const {
+	Array ret;
+	for (int i = 0; i < polygons.size(); ++i) {
+		ret.push_back(polygons[i]);
+	}
+	return ret;
+}
+
+void PolyIndex2D::_build() {
+	bvh_nodes.clear();
+	bvh_items.clear();
+	polygon_slabs.clear();
+	polygon_slabs.resize(polygons.size());
+
+	Vector<Rect2> rects;
+	rects.resize(polygons.size());
+	Vector<Point2> centers;
+	centers.resize(polygons.size());
+
+	for (int i = 0; i < polygons.size(); ++i) {
+		if (polygons[i].size() < 3) {
+			continue; // Cannot contain any points.
+		}
+		const Rect2 rect = GoostGeometry2D::bounding_rect(polygons[i]);
+		rects.write[i] = rect;
+		centers.write[i] = rect.position + rect.size * 0.5;
+		bvh_items.push_back(i);
+		_build_slabs(i, rect);
+	}
+	if (!bvh_items.empty()) {
+		_build_bvh(0, bvh_items.size(), rects, centers);
+	}
+}
+
+int PolyIndex2D::_build_bvh(int p_begin, int p_end, const Vector<Rect2> &p_rects, const Vector<Point2> &p_centers) {
+	const int idx = bvh_nodes.size();
+	bvh_nodes.push_back(BVHNode());
+
+	Rect2 rect = p_rects[bvh_items[p_begin]];
+	Rect2 center_bounds(p_centers[bvh_items[p_begin]], Size2());
+	for (int i = p_begin + 1; i < p_end; ++i) {
+		rect = rect.merge(p_rects[bvh_items[i]]);
+		center_bounds.expand_to(p_centers[bvh_items[i]]);
+	}
+	if (p_end - p_begin <= BVH_LEAF_SIZE) {
+		BVHNode &leaf = bvh_nodes.write[idx];
+		leaf.rect = rect;
+		leaf.begin = p_begin;
+		leaf.end = p_end;
+		return idx;
+	}
+	// Split at the median along the longest axis.
+	SortArray<int, _PolyIndex2DCenterSort> sorter;
+	sorter.compare.centers = p_centers.ptr();
+	sorter.compare.axis = center_bounds.size.x >= center_bounds.size.y ? 0 : 1;
+	sorter.sort_range(p_begin, p_end, bvh_items.ptrw());
+
+	const int mid = (p_begin + p_end) / 2;
+	const int left = _build_bvh(p_begin, mid, p_rects, p_centers);
+	const int right = _build_bvh(mid, p_end, p_rects, p_centers);
+
+	BVHNode &node = bvh_nodes.write[idx];
+	node.rect = rect;
+	node.left = left;
+	node.right = right;
+	return idx;
+}
+
+void PolyIndex2D::_build_slabs(int p_polygon, const Rect2 &p_rect) {
+	const Vector<Point2> &polygon = polygons[p_polygon];
+	const Point2 *ptr = polygon.ptr();
+	const int count = polygon.size();
+
+	EdgeSlabs &es = polygon_slabs.write[p_polygon];
+	es.rect = p_rect;
+	es.slab_count = CLAMP(count / 2, 1, MAX_SLAB_COUNT);
+	es.slab_height = p_rect.size.y / es.slab_count;
+	if (es.slab_height <= 0.0) {
+		es.slab_count = 1;
+	}
+	// Mapping of coordinates to slabs is monotonic, so a point within the
+	// vertical extent of an edge always falls into one of the edge's slabs.
+	auto slab_of = [&es](real_t p_y) -> int {
+		return _slab_of(p_y, es.rect.position.y, es.slab_height, es.slab_count);
+	};
+	es.offsets.resize(es.slab_count + 1);
+	int *offsets = es.offsets.ptrw();
+	for (int i = 0; i <= es.slab_count; ++i) {
+		offsets[i] = 0;
+	}
+	for (int i = 0; i < count; ++i) {
+		const Point2 &a = ptr[i];
+		const Point2 &b = ptr[i + 1 == count ? 0 : i + 1];
+		const int s_end = slab_of(MAX(a.y, b.y));
+		for (int s = slab_of(MIN(a.y, b.y)); s <= s_end; ++s) {
+			offsets[s + 1]++;
+		}
+	}
+	for (int i = 0; i < es.slab_count; ++i) {
+		offsets[i + 1] += offsets[i];
+	}
+	es.edges.resize(offsets[es.slab_count]);
+	int *edges = es.edges.ptrw();
+
+	Vector<int> fill;
+	fill.resize(es.slab_count);
+	int *f = fill.ptrw();
+	for (int i = 0; i < es.slab_count; ++i) {
+		f[i] = offsets[i];
+	}
+	for (int i = 0; i < count; ++i) {
+		const Point2 &a = ptr[i];
+		const Point2 &b = ptr[i + 1 == count ? 0 : i + 1];
+		const int s_end = slab_of(MAX(a.y, b.y));
+		for (int s = slab_of(MIN(a.y, b.y)); s <= s_end; ++s) {
+			edges[f[s]++] = i;
+		}
+	}
+}
+
+int PolyIndex2D::_point_in_polygon(int p_polygon, const Point2 &p_point) const {
+	const EdgeSlabs &es = polygon_slabs[p_polygon];
+	if (!_rect_has_point(es.rect, p_point)) {
+		return 0; // Leaves only test the rect of all their polygons.
+	}
+	const Point2 *ptr = polygons[p_polygon].ptr();
+	const int count = polygons[p_polygon].size();
+
+	const int slab = _slab_of(p_point.y, es.rect.position.y, es.slab_height, es.slab_count);
+	const int *edges = es.edges.ptr();
+	int result = 0;
+	for (int i = es.offsets[slab]; i < es.offsets[slab + 1]; ++i) {
+		const int e = edges[i];
+		const int crossing = GoostGeometry2D::point_in_polygon_edge(p_point, ptr[e], ptr[e + 1 == count ? 0 : e + 1]);
+		if (crossing < 0) {
+			return -1;
+		}
+		result ^= crossing;
+	}
+	return result;
+}
+
+int PolyIndex2D::find_polygon(const Point2 &p_point) const {
+	if (bvh_nodes.empty()) {
+		return -1;
+	}
+	const BVHNode *nodes = bvh_nodes.ptr();
+	const int *items = bvh_items.ptr();
+
+	int found = -1;
+	int stack[BVH_MAX_DEPTH];
+	int stack_size = 0;
+	stack[stack_size++] = 0;
+
+	while (stack_size > 0) {
+		const BVHNode &node = nodes[stack[--stack_size]];
+		if (!_rect_has_point(node.rect, p_point)) {
+			continue;
+		}
+		if (node.left < 0) {
+			for (int i = node.begin; i < node.end; ++i) {
+				const int p = items[i];
+				if (found >= 0 && p > found) {
+					continue;
+				}
+				if (_point_in_polygon(p, p_point) != 0) {
+					found = p;
+				}
+			}
+			continue;
+		}
+		ERR_FAIL_COND_V(stack_size + 2 > BVH_MAX_DEPTH, found);
+		stack[stack_size++] = node.left;
+		stack[stack_size++] = node.right;
+	}
+	return found;
+}
+
+Vector<int> PolyIndex2D::point_in_polygons(const Vector<Point2> &p_points) const {
+	Vector<int> ret;
+	ret.resize(p_points.size());
+
+	const Point2 *points = p_points.ptr();
+	int *r = ret.ptrw();
+	for (int i = 0; i < p_points.size(); ++i) {
+		r[i] = find_polygon(points[i]);
+	}
+	return ret;
+}
+
+void PolyIndex2D::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_polygons", "polygons"), &PolyIndex2D::set_polygons_array);
+	ClassDB::bind_method(D_METHOD("get_polygons"), &PolyIndex2D::get_polygons_array);
+
+	ClassDB::bind_method(D_METHOD("get_polygon_count"), &PolyIndex2D::get_polygon_count);
+
+	ClassDB::bind_method(D_METHOD("find_polygon", "point"), &PolyIndex2D::find_polygon);
+	ClassDB::bind_method(D_METHOD("point_in_polygons", "points"), &PolyIndex2D::point_in_polygons);
+
+	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "polygons"), "set_polygons", "get_polygons");
+}
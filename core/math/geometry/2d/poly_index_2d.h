@@ -0,0 +1,52 @@
+#pragma once
+
+#include "core/resource.h"
+
+// A set of polygons indexed for fast point queries. Polygons are organized in
+// a bounding volume hierarchy, and edges of each polygon are bucketed into
+// horizontal slabs, so that only edges near the query point are tested.
+class PolyIndex2D : public Resource {
+	GDCLASS(PolyIndex2D, Resource);
+
+	Vector<Vector<Point2>> polygons;
+
+	struct BVHNode {
+		Rect2 rect;
+		int left = -1; // Child node indices, -1 for leaves.
+		int right = -1;
+		int begin = 0; // Range of polygon indices in `bvh_items` for leaves.
+		int end = 0;
+	};
+	Vector<BVHNode> bvh_nodes;
+	Vector<int> bvh_items;
+
+	struct EdgeSlabs {
+		Rect2 rect; // Of the polygon.
+		real_t slab_height = 0.0;
+		int slab_count = 0;
+		Vector<int> offsets; // Ranges in `edges` for each slab, `slab_count + 1` in total.
+		Vector<int> edges; // Index of the first vertex of each edge.
+	};
+	Vector<EdgeSlabs> polygon_slabs;
+
+	void _build();
+	int _build_bvh(int p_begin, int p_end, const Vector<Rect2> &p_rects, const Vector<Point2> &p_centers);
+	void _build_slabs(int p_polygon, const Rect2 &p_rect);
+	int _point_in_polygon(int p_polygon, const Point2 &p_point) const;
+
+protected:
+	static void _bind_methods();
+
+public:
+	void set_polygons(const Vector<Vector<Point2>> &p_polygons);
+	Vector<Vector<Point2>> get_polygons() const { return polygons; }
+
+	void set_polygons_array(const Array &p_polygons);
+	Array get_polygons_array() const;
+
+	int get_polygon_count() const { return polygons.size(); }
+
+	// Returns the smallest index of a polygon containing the point, or -1.
+	int find_polygon(const Point2 &p_point) const;
+	Vector<int> point_in_polygons(const Vector<Point2> &p_points) const;
+};
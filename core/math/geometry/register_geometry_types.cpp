@@ -28,6 +28,7 @@ void register_geometry_types() {
 #endif
 	ClassDB::register_class<PolyBooleanParameters2D>();
 	ClassDB::register_class<PolyNode2D>();
+	ClassDB::register_class<PolyPaths2D>();
 
 #ifdef GOOST_PolyOffset2D
 	_poly_offset_2d.instance();
@@ -36,6 +37,7 @@ void register_geometry_types() {
 	Engine::get_singleton()->add_singleton(Engine::Singleton("PolyOffset2D", poly_offset_2d));
 #endif
 	ClassDB::register_class<PolyOffsetParameters2D>();
+	ClassDB::register_class<PolyOffsetCache2D>();
 
 #ifdef GOOST_PolyDecomp2D
 	_poly_decomp_2d.instance();
@@ -45,6 +47,10 @@ void register_geometry_types() {
 #endif
 	ClassDB::register_class<PolyDecompParameters2D>();
 
+#ifdef GOOST_PolyIndex2D
+	ClassDB::register_class<PolyIndex2D>();
+#endif
+
 #ifdef GOOST_Random2D
 	_random_2d.instance();
 	ClassDB::register_class<Random2D>();
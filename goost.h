@@ -6,6 +6,8 @@
 #include "core/image/goost_image_bind.h"
 #include "core/image/image_blender.h"
 #include "core/image/image_indexed.h"
+#include "core/image/image_pipeline.h"
+#include "core/image/image_pix.h"
 #include "core/invoke_state.h"
 #include "core/math/geometry/2d/goost_geometry_2d.h"
 #include "core/math/geometry/2d/goost_geometry_2d_bind.h"
@@ -13,6 +15,8 @@
 #include "core/math/geometry/2d/poly/decomp/poly_decomp.h"
 #include "core/math/geometry/2d/poly/offset/poly_offset.h"
 #include "core/math/geometry/2d/poly/poly_backends.h"
+#include "core/math/geometry/2d/poly/poly_paths_2d.h"
+#include "core/math/geometry/2d/poly_index_2d.h"
 #include "core/math/geometry/2d/random_2d.h"
 #include "core/math/random.h"
 #include "core/script/mixin_script/mixin_script.h"
@@ -158,6 +158,8 @@ classes = {
     "ImageBlender": "image",
     "ImageFrames": "image",  # modules/gif
     "ImageIndexed": "image",
+    "ImagePipeline": "image",
+    "ImagePix": "image",
     "InvokeState": "core",
     "LightTexture": "scene",
     "LinkedList": "core",
@@ -168,13 +170,16 @@ classes = {
     "PolyBooleanParameters2D": "geometry",
     "PolyDecomp2D": "geometry",
     "PolyDecompParameters2D": "geometry",
+    "PolyIndex2D": "geometry",
     "PolyOffset2D": "geometry",
+    "PolyOffsetCache2D": "geometry",
     "PolyOffsetParameters2D": "geometry",
     "PolyCapsule2D": "scene",
     "PolyCircle2D": "scene",
     "PolyCollisionShape2D": "physics",
     "PolyNode2D": "geometry",
     "PolyPath2D": "geometry",
+    "PolyPaths2D": "geometry",
     "PolyRectangle2D": "scene",
     "PolyShape2D": "scene",
     "Random": "math",
@@ -210,14 +215,17 @@ class_dependencies = {
     "CommandLineParser": ["CommandLineOption", "CommandLineHelpFormat"],
     "GoostEngine" : "InvokeState",
     "GoostGeometry2D" : ["PolyBoolean2D", "PolyDecomp2D", "PolyOffset2D"],
+    "ImagePipeline" : ["GoostImage", "ImagePix"],
+    "ImagePix" : "GoostImage",
     "LightTexture" : "GradientTexture2D",
     "LinkedList" : "ListNode",
     "MixinScript" : "Mixin",
-    "PolyBoolean2D" : ["PolyBooleanParameters2D", "PolyNode2D"],
-    "PolyDecomp2D" : "PolyDecompParameters2D",
+    "PolyBoolean2D" : ["PolyBooleanParameters2D", "PolyNode2D", "PolyPaths2D"],
+    "PolyDecomp2D" : ["PolyDecompParameters2D", "PolyPaths2D"],
+    "PolyIndex2D" : "GoostGeometry2D",
     "PolyCapsule2D" : ["GoostGeometry2D", "PolyNode2D"],
     "PolyCircle2D" : ["GoostGeometry2D", "PolyNode2D"],
-    "PolyOffset2D" : "PolyOffsetParameters2D",
+    "PolyOffset2D" : ["PolyOffsetParameters2D", "PolyOffsetCache2D", "PolyPaths2D", "PolyBoolean2D"],
     "PolyPath2D" : ["PolyOffset2D", "PolyOffsetParameters2D"],
     "PolyRectangle2D" : "PolyNode2D",
     "PolyShape2D" : "PolyNode2D",
@@ -151,19 +151,34 @@ void PolyPath2D::set_buffer_offset(real_t p_buffer_offset) {
 
 void PolyPath2D::set_buffer_parameters(const Ref<PolyOffsetParameters2D> &p_buffer_parameters) {
 	if (buffer_parameters.is_valid()) {
-		if (buffer_parameters->is_connected(CoreStringNames::get_singleton()->changed, this, "_queue_update")) {
-			buffer_parameters->disconnect(CoreStringNames::get_singleton()->changed, this, "_queue_update");
+		if (buffer_parameters->is_connected(CoreStringNames::get_singleton()->changed, this, "_buffer_changed")) {
+			buffer_parameters->disconnect(CoreStringNames::get_singleton()->changed, this, "_buffer_changed");
 		}
 	}
 	buffer_parameters = p_buffer_parameters;
 
 	if (buffer_parameters.is_valid()) {
-		buffer_parameters->connect(CoreStringNames::get_singleton()->changed, this, "_queue_update");
+		buffer_parameters->connect(CoreStringNames::get_singleton()->changed, this, "_buffer_changed");
 	}
-	_queue_update();
+	_buffer_changed();
 	_change_notify("buffer_parameters");
 }
 
+void PolyPath2D::set_buffer_cached(bool p_buffer_cached) {
+	buffer_cached = p_buffer_cached;
+	if (!buffer_cached) {
+		buffer_cache.unref();
+		buffer_polylines.clear();
+	}
+	_queue_update();
+	_change_notify("buffer_cached");
+}
+
+void PolyPath2D::_buffer_changed() {
+	buffer_cache.unref();
+	_queue_update();
+}
+
 void PolyPath2D::set_tessellation_stages(int p_tessellation_stages) {
 	tessellation_stages = MAX(1, p_tessellation_stages);
 	_queue_update();
@@ -205,11 +220,39 @@ Vector<Vector<Point2>> PolyPath2D::_build_outlines() {
 		to_deflate.push_back(polyline);
 	}
 	// Deflate!
-	if (buffer_offset > 0.0) {
-		outlines = PolyOffset2D::deflate_polylines(to_deflate, buffer_offset, buffer_parameters);
-	} else {
-		outlines = to_deflate;
+	if (buffer_offset <= 0.0) {
+		return to_deflate;
 	}
+	if (!buffer_cached) {
+		return PolyOffset2D::deflate_polylines(to_deflate, buffer_offset, buffer_parameters);
+	}
+	bool rebuild = buffer_cache.is_null() || to_deflate.size() != buffer_polylines.size();
+	// Arcs are approximated for the maximum offset, so rebuild if it's far off.
+	rebuild = rebuild || buffer_offset > buffer_cache->get_max_delta() || buffer_offset < buffer_cache->get_max_delta() * 0.25;
+	for (int i = 0; i < to_deflate.size() && !rebuild; ++i) {
+		const Vector<Point2> &a = to_deflate[i];
+		const Vector<Point2> &b = buffer_polylines[i];
+		if (a.size() != b.size()) {
+			rebuild = true;
+			break;
+		}
+		const Point2 *ra = a.ptr();
+		const Point2 *rb = b.ptr();
+		for (int j = 0; j < a.size(); ++j) {
+			if (ra[j] != rb[j]) {
+				rebuild = true;
+				break;
+			}
+		}
+	}
+	if (rebuild) {
+		// Leave room for animating the offset, but make sure that the outlines
+		// are the same as without the cache until the offset changes.
+		buffer_cache = PolyOffset2D::deflate_polylines_cached(to_deflate, buffer_offset * 2.0, buffer_parameters);
+		buffer_polylines = to_deflate;
+		return PolyOffset2D::deflate_polylines(to_deflate, buffer_offset, buffer_parameters);
+	}
+	outlines = buffer_cache->offset(buffer_offset);
 	return outlines;
 }
 
@@ -256,12 +299,17 @@ String PolyPath2D::get_configuration_warning() const {
 }
 
 void PolyPath2D::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("_buffer_changed"), &PolyPath2D::_buffer_changed);
+
 	ClassDB::bind_method(D_METHOD("set_buffer_offset", "buffer_offset"), &PolyPath2D::set_buffer_offset);
 	ClassDB::bind_method(D_METHOD("get_buffer_offset"), &PolyPath2D::get_buffer_offset);
 
 	ClassDB::bind_method(D_METHOD("set_buffer_parameters", "buffer_parameters"), &PolyPath2D::set_buffer_parameters);
 	ClassDB::bind_method(D_METHOD("get_buffer_parameters"), &PolyPath2D::get_buffer_parameters);
 
+	ClassDB::bind_method(D_METHOD("set_buffer_cached", "buffer_cached"), &PolyPath2D::set_buffer_cached);
+	ClassDB::bind_method(D_METHOD("is_buffer_cached"), &PolyPath2D::is_buffer_cached);
+
 	ClassDB::bind_method(D_METHOD("set_tessellation_stages", "tessellation_stages"), &PolyPath2D::set_tessellation_stages);
 	ClassDB::bind_method(D_METHOD("get_tessellation_stages"), &PolyPath2D::get_tessellation_stages);
 
@@ -271,6 +319,7 @@ void PolyPath2D::_bind_methods() {
 	ADD_GROUP("Buffer", "buffer_");
 	ADD_PROPERTY(PropertyInfo(Variant::REAL, "buffer_offset", PROPERTY_HINT_RANGE, "0.01,256.0,0.01,or_greater"), "set_buffer_offset", "get_buffer_offset");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "buffer_parameters", PROPERTY_HINT_RESOURCE_TYPE, "PolyOffsetParameters2D"), "set_buffer_parameters", "get_buffer_parameters");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "buffer_cached"), "set_buffer_cached", "is_buffer_cached");
 
 	ADD_GROUP("Tessellation", "tessellation_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "tessellation_stages", PROPERTY_HINT_RANGE, "1,6,1"), "set_tessellation_stages", "get_tessellation_stages");
@@ -79,6 +79,12 @@ class PolyPath2D : public PolyNode2D {
 	real_t buffer_offset = 32.0;
 	Ref<PolyOffsetParameters2D> buffer_parameters;
 
+	// Allows to animate the offset without offsetting from scratch.
+	bool buffer_cached = false;
+	Ref<PolyOffsetCache2D> buffer_cache;
+	Vector<Vector<Point2>> buffer_polylines;
+	void _buffer_changed();
+
 	int tessellation_stages = 4;
 	float tessellation_tolerance_degrees = 4.0f;
 
@@ -97,6 +103,9 @@ public:
 	void set_buffer_parameters(const Ref<PolyOffsetParameters2D> &p_buffer_parameters);
 	Ref<PolyOffsetParameters2D> get_buffer_parameters() const { return buffer_parameters; }
 
+	void set_buffer_cached(bool p_buffer_cached);
+	bool is_buffer_cached() const { return buffer_cached; }
+
 	void set_tessellation_stages(int p_tessellation_stages);
 	int get_tessellation_stages() const { return tessellation_stages; }
 	
@@ -4,7 +4,6 @@
 #include "core/math/geometry.h"
 
 #include "goost/core/math/geometry/2d/goost_geometry_2d.h"
-#include "goost/core/math/geometry/2d/poly/decomp/poly_decomp.h"
 
 Vector<Vector<Point2>> PolyShape2D::_collect_outlines() {
 	Vector<Vector<Point2>> ret;
@@ -17,7 +16,7 @@ Vector<Vector<Point2>> PolyShape2D::_collect_outlines() {
 			continue;
 		}
 		Transform2D trans = n->get_transform();
-		const Vector<Vector<Point2>> &outlines = n->build_outlines();
+		const Vector<Vector<Point2>> &outlines = n->get_outlines();
 		for (int j = 0; j < outlines.size(); ++j) {
 			Vector<Point2> poly = outlines[j];
 			{
@@ -32,32 +31,47 @@ Vector<Vector<Point2>> PolyShape2D::_collect_outlines() {
 	return ret;
 }
 
-Vector<Vector<Point2>> PolyShape2D::_build_shapes() {
-	shapes.clear();
-	const Vector<Vector<Point2>> &outlines = _collect_outlines();
-	if (outlines.empty()) {
+Ref<PolyDecompParameters2D> PolyShape2D::_create_decomp_parameters() const {
+	Ref<PolyDecompParameters2D> params;
+	params.instance();
+	params->concavity = concavity;
+	params->max_pieces = max_shapes;
+	return params;
+}
+
+Vector<Vector<Point2>> PolyShape2D::_decompose_outlines(const Vector<Vector<Point2>> &p_outlines, BuildMode p_mode, const Ref<PolyDecompParameters2D> &p_parameters) {
+	Vector<Vector<Point2>> shapes;
+	if (p_outlines.empty()) {
 		return shapes;
 	}
-	switch (build_mode) {
+	switch (p_mode) {
 		case BUILD_TRIANGLES: {
-			shapes.append_array(PolyDecomp2D::triangulate_polygons(outlines));
+			shapes.append_array(PolyDecomp2D::triangulate_polygons(p_outlines));
 		} break;
 		case BUILD_CONVEX: {
-			shapes.append_array(PolyDecomp2D::decompose_polygons_into_convex(outlines));
+			shapes.append_array(PolyDecomp2D::decompose_polygons_into_convex(p_outlines));
 		} break;
 		case BUILD_SEGMENTS: {
 			// Concave shapes cannot have inner outlines, so filter those out.
-			for (int i = 0; i < outlines.size(); ++i) {
-				const Vector<Point2> &points = outlines[i];
+			for (int i = 0; i < p_outlines.size(); ++i) {
+				const Vector<Point2> &points = p_outlines[i];
 				if (!Geometry::is_polygon_clockwise(points)) {
 					shapes.push_back(points);
 				}
 			}
 		} break;
+		case BUILD_CONVEX_APPROX: {
+			shapes.append_array(PolyDecomp2D::decompose_polygons(p_outlines, PolyDecomp2D::DECOMP_CONVEX_APPROX, p_parameters));
+		} break;
 	}
 	return shapes;
 }
 
+Vector<Vector<Point2>> PolyShape2D::_build_shapes() {
+	shapes = _decompose_outlines(_collect_outlines(), build_mode, _create_decomp_parameters());
+	return shapes;
+}
+
 Array PolyShape2D::get_shapes_array() {
 	Array ret;
 	for (int i = 0; i < shapes.size(); ++i) {
@@ -99,7 +113,42 @@ void PolyShape2D::_queue_update() {
 }
 
 void PolyShape2D::_update_shapes() {
+	if (async_build && is_inside_tree()) {
+		update_queued = false;
+		if (async_builder.request()) {
+			async_outlines = _collect_outlines();
+			async_build_mode = build_mode;
+			async_parameters = _create_decomp_parameters();
+			async_builder.start(_async_build, this);
+		}
+		return;
+	}
 	_build_shapes();
+	_shapes_built();
+}
+
+void PolyShape2D::_async_build(void *p_userdata) {
+	PolyShape2D *shape = static_cast<PolyShape2D *>(p_userdata);
+	shape->async_shapes = _decompose_outlines(shape->async_outlines, shape->async_build_mode, shape->async_parameters);
+	shape->call_deferred("_finish_async_build");
+}
+
+void PolyShape2D::_finish_async_build() {
+	if (!async_builder.finish()) {
+		return;
+	}
+	shapes = async_shapes;
+	async_shapes.clear();
+	async_outlines.clear();
+	async_parameters.unref();
+	_shapes_built();
+
+	if (async_builder.is_restart_needed()) {
+		_update_shapes();
+	}
+}
+
+void PolyShape2D::_shapes_built() {
 	auto script = get_script_instance();
 	if (script && script->has_method("_apply_shapes")) {
 		script->call("_apply_shapes");
@@ -139,9 +188,38 @@ void PolyShape2D::_notification(int p_what) {
 }
 
 void PolyShape2D::set_build_mode(BuildMode p_mode) {
-	ERR_FAIL_INDEX((int)p_mode, 3);
+	ERR_FAIL_INDEX((int)p_mode, 4);
 	build_mode = p_mode;
 	_queue_update();
+	_change_notify();
+}
+
+void PolyShape2D::set_concavity(real_t p_concavity) {
+	ERR_FAIL_COND_MSG(p_concavity < 0.0, "Concavity must be non-negative.");
+	concavity = p_concavity;
+	if (build_mode == BUILD_CONVEX_APPROX) {
+		_queue_update();
+	}
+}
+
+void PolyShape2D::set_max_shapes(int p_max_shapes) {
+	ERR_FAIL_COND_MSG(p_max_shapes < 0, "Max shapes must be non-negative.");
+	max_shapes = p_max_shapes;
+	if (build_mode == BUILD_CONVEX_APPROX) {
+		_queue_update();
+	}
+}
+
+void PolyShape2D::_validate_property(PropertyInfo &property) const {
+	if (property.name == "concavity" || property.name == "max_shapes") {
+		if (build_mode != BUILD_CONVEX_APPROX) {
+			property.usage = PROPERTY_USAGE_NOEDITOR;
+		}
+	}
+}
+
+void PolyShape2D::set_async_build(bool p_async_build) {
+	async_build = p_async_build;
 }
 
 String PolyShape2D::get_configuration_warning() const {
@@ -168,17 +246,35 @@ void PolyShape2D::_bind_methods() {
 	BIND_VMETHOD(MethodInfo(Variant::NIL, "_apply_shapes"));
 	ClassDB::bind_method(D_METHOD("_update_shapes"), &PolyShape2D::_update_shapes);
 	ClassDB::bind_method(D_METHOD("_queue_update"), &PolyShape2D::_queue_update);
+	ClassDB::bind_method(D_METHOD("_finish_async_build"), &PolyShape2D::_finish_async_build);
 
 	ClassDB::bind_method(D_METHOD("get_shapes"), &PolyShape2D::get_shapes_array);
 
 	ClassDB::bind_method(D_METHOD("set_build_mode", "build_mode"), &PolyShape2D::set_build_mode);
 	ClassDB::bind_method(D_METHOD("get_build_mode"), &PolyShape2D::get_build_mode);
 
-	ADD_PROPERTY(PropertyInfo(Variant::INT, "build_mode", PROPERTY_HINT_ENUM, "Triangles,Convex,Segments"), "set_build_mode", "get_build_mode");
+	ClassDB::bind_method(D_METHOD("set_concavity", "concavity"), &PolyShape2D::set_concavity);
+	ClassDB::bind_method(D_METHOD("get_concavity"), &PolyShape2D::get_concavity);
+
+	ClassDB::bind_method(D_METHOD("set_max_shapes", "max_shapes"), &PolyShape2D::set_max_shapes);
+	ClassDB::bind_method(D_METHOD("get_max_shapes"), &PolyShape2D::get_max_shapes);
+
+	ClassDB::bind_method(D_METHOD("set_async_build", "async_build"), &PolyShape2D::set_async_build);
+	ClassDB::bind_method(D_METHOD("is_async_build"), &PolyShape2D::is_async_build);
+
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "build_mode", PROPERTY_HINT_ENUM, "Triangles,Convex,Segments,Convex Approx"), "set_build_mode", "get_build_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::REAL, "concavity", PROPERTY_HINT_RANGE, "0,64,0.01,or_greater"), "set_concavity", "get_concavity");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_shapes", PROPERTY_HINT_RANGE, "0,256,1,or_greater"), "set_max_shapes", "get_max_shapes");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "async_build"), "set_async_build", "is_async_build");
 
 	ADD_SIGNAL(MethodInfo("shapes_applied"));
 
 	BIND_ENUM_CONSTANT(BUILD_TRIANGLES);
 	BIND_ENUM_CONSTANT(BUILD_CONVEX);
 	BIND_ENUM_CONSTANT(BUILD_SEGMENTS);
+	BIND_ENUM_CONSTANT(BUILD_CONVEX_APPROX);
+}
+
+PolyShape2D::~PolyShape2D() {
+	async_builder.finish(); // Before the outlines it decomposes are destroyed.
 }
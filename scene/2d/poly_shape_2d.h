@@ -1,5 +1,7 @@
 #pragma once
 
+#include "goost/core/math/geometry/2d/poly/decomp/poly_decomp.h"
+#include "goost/core/math/geometry/2d/poly/poly_async_build.h"
 #include "goost/core/math/geometry/2d/poly/poly_node_2d.h"
 
 class PolyShape2D : public Node2D {
@@ -10,16 +12,34 @@ public:
 		BUILD_TRIANGLES,
 		BUILD_CONVEX,
 		BUILD_SEGMENTS,
+		BUILD_CONVEX_APPROX,
 	};
 
 private:
 	Vector<Vector<Point2>> _collect_outlines();
+	Ref<PolyDecompParameters2D> _create_decomp_parameters() const;
+	static Vector<Vector<Point2>> _decompose_outlines(const Vector<Vector<Point2>> &p_outlines, BuildMode p_mode, const Ref<PolyDecompParameters2D> &p_parameters);
+
+	// Shapes can be decomposed on a thread from outlines collected on the
+	// main thread, and applied once ready.
+	bool async_build = false;
+	PolyAsyncBuild2D async_builder;
+	Vector<Vector<Point2>> async_outlines;
+	BuildMode async_build_mode = BUILD_TRIANGLES;
+	Ref<PolyDecompParameters2D> async_parameters;
+	Vector<Vector<Point2>> async_shapes;
+
+	static void _async_build(void *p_userdata);
+	void _finish_async_build();
+	void _shapes_built();
 
 protected:
 	Vector<Vector<Point2>> shapes;
 	bool update_queued = false;
 
 	BuildMode build_mode = BUILD_TRIANGLES;
+	real_t concavity = 1.0; // For BUILD_CONVEX_APPROX.
+	int max_shapes = 0;
 	Rect2 rect = Rect2(-10, -10, 20, 20);
 	PolyNode2D *child = nullptr;
 
@@ -32,16 +52,28 @@ protected:
 	virtual void remove_child_notify(Node *p_child);
 
 	void _notification(int p_what);
+	virtual void _validate_property(PropertyInfo &property) const;
 	static void _bind_methods();
 
 public:
 	void set_build_mode(BuildMode p_mode);
 	BuildMode get_build_mode() const { return build_mode; }
 
+	void set_concavity(real_t p_concavity);
+	real_t get_concavity() const { return concavity; }
+
+	void set_max_shapes(int p_max_shapes);
+	int get_max_shapes() const { return max_shapes; }
+
+	void set_async_build(bool p_async_build);
+	bool is_async_build() const { return async_build; }
+
 	void update_shapes();
 	Array get_shapes_array();
 
 	virtual String get_configuration_warning() const;
+
+	~PolyShape2D();
 };
 
 VARIANT_ENUM_CAST(PolyShape2D::BuildMode);
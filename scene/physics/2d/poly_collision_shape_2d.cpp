@@ -1,50 +1,150 @@
 #include "poly_collision_shape_2d.h"
 
 #include "core/engine.h"
+#include "core/hashfuncs.h"
+#include "core/map.h"
 #include "scene/2d/collision_object_2d.h"
 #include "scene/resources/concave_polygon_shape_2d.h"
 #include "scene/resources/convex_polygon_shape_2d.h"
 
+static PoolVector<Vector2> _polygon_to_segments(const Vector<Point2> &p_polygon) {
+	PoolVector<Vector2> segments;
+	segments.resize(p_polygon.size() * 2);
+	PoolVector<Vector2>::Write w = segments.write();
+
+	const int vertices_count = p_polygon.size();
+	for (int j = 0; j < vertices_count; j++) {
+		w[(j << 1) + 0] = p_polygon[j];
+		w[(j << 1) + 1] = p_polygon[(j + 1) % vertices_count];
+	}
+	w.release();
+	return segments;
+}
+
+static _FORCE_INLINE_ uint32_t _hash_points(const Vector<Point2> &p_points) {
+	return hash_djb2_buffer((const uint8_t *)p_points.ptr(), p_points.size() * sizeof(Point2));
+}
+
+static bool _points_equal(const Vector<Point2> &p_a, const Vector<Point2> &p_b) {
+	if (p_a.size() != p_b.size()) {
+		return false;
+	}
+	const Point2 *a = p_a.ptr();
+	const Point2 *b = p_b.ptr();
+	for (int i = 0; i < p_a.size(); ++i) {
+		if (a[i] != b[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+Ref<Shape2D> PolyCollisionShape2D::_create_shape(const Vector<Point2> &p_points) const {
+	if (applied_segments) {
+		Ref<ConcavePolygonShape2D> concave = memnew(ConcavePolygonShape2D);
+		concave->set_segments(_polygon_to_segments(p_points));
+		return concave;
+	}
+	Ref<ConvexPolygonShape2D> convex = memnew(ConvexPolygonShape2D);
+	convex->set_points(p_points);
+	return convex;
+}
+
+void PolyCollisionShape2D::_update_shape(const Ref<Shape2D> &p_shape, const Vector<Point2> &p_points) const {
+	if (applied_segments) {
+		Ref<ConcavePolygonShape2D> concave = p_shape;
+		ERR_FAIL_COND(concave.is_null());
+		concave->set_segments(_polygon_to_segments(p_points));
+	} else {
+		Ref<ConvexPolygonShape2D> convex = p_shape;
+		ERR_FAIL_COND(convex.is_null());
+		convex->set_points(p_points);
+	}
+}
+
+void PolyCollisionShape2D::_clear_applied_shapes() {
+	applied_shapes.clear();
+	applied_hashes.clear();
+}
+
+// Shapes are reconciled with the ones already added to the shape owner rather
+// than recreated, so that small changes only touch the affected shapes.
 void PolyCollisionShape2D::_apply_shapes() {
 	if (!parent) {
 		return;
 	}
-	parent->shape_owner_clear_shapes(owner_id);
-	if (shapes.empty()) {
-		return;
+	const bool segments = build_mode == BUILD_SEGMENTS;
+	if (segments != applied_segments || parent->shape_owner_get_shape_count(owner_id) != applied_shapes.size()) {
+		// Shapes of different type cannot be reused.
+		parent->shape_owner_clear_shapes(owner_id);
+		_clear_applied_shapes();
+		applied_segments = segments;
 	}
-	switch (build_mode) {
-		case BUILD_TRIANGLES:
-		case BUILD_CONVEX: {
-			for (int i = 0; i < shapes.size(); i++) {
-				Ref<ConvexPolygonShape2D> convex = memnew(ConvexPolygonShape2D);
-				convex->set_points(shapes[i]);
-				parent->shape_owner_add_shape(owner_id, convex);
-			}
-		} break;
-		case BUILD_SEGMENTS: {
-			for (int i = 0; i < shapes.size(); i++) {
-				const Vector<Point2> &polygon = shapes[i];
-				if (polygon.size() < 2) {
-					continue;
-				}
-				Ref<ConcavePolygonShape2D> concave = memnew(ConcavePolygonShape2D);
-
-				PoolVector<Vector2> segments;
-				segments.resize(polygon.size() * 2);
-				PoolVector<Vector2>::Write w = segments.write();
+	Vector<Vector<Point2>> pieces;
+	for (int i = 0; i < shapes.size(); i++) {
+		if (segments && shapes[i].size() < 2) {
+			continue;
+		}
+		pieces.push_back(shapes[i]);
+	}
+	const int applied_count = applied_shapes.size();
 
-				const int vertices_count = polygon.size();
-				for (int j = 0; j < vertices_count; j++) {
-					w[(j << 1) + 0] = polygon[j];
-					w[(j << 1) + 1] = polygon[(j + 1) % vertices_count];
+	Map<uint32_t, Vector<int>> existing;
+	for (int i = 0; i < applied_count; ++i) {
+		existing[applied_hashes[i]].push_back(i);
+	}
+	Vector<bool> used;
+	used.resize(applied_count);
+	bool *u = used.ptrw();
+	for (int i = 0; i < applied_count; ++i) {
+		u[i] = false;
+	}
+	// Keep shapes which did not change.
+	Vector<int> changed;
+	for (int i = 0; i < pieces.size(); ++i) {
+		bool found = false;
+		Map<uint32_t, Vector<int>>::Element *E = existing.find(_hash_points(pieces[i]));
+		if (E) {
+			const Vector<int> &candidates = E->get();
+			for (int j = 0; j < candidates.size(); ++j) {
+				const int idx = candidates[j];
+				if (!u[idx] && _points_equal(applied_shapes[idx], pieces[i])) {
+					u[idx] = true;
+					found = true;
+					break;
 				}
-				w.release();
-				concave->set_segments(segments);
-
-				parent->shape_owner_add_shape(owner_id, concave);
 			}
-		} break;
+		}
+		if (!found) {
+			changed.push_back(i);
+		}
+	}
+	// Update the remaining shapes in place, and add new ones if needed.
+	int slot = 0;
+	for (int i = 0; i < changed.size(); ++i) {
+		const Vector<Point2> &points = pieces[changed[i]];
+		while (slot < applied_count && u[slot]) {
+			++slot;
+		}
+		if (slot < applied_count) {
+			_update_shape(parent->shape_owner_get_shape(owner_id, slot), points);
+			applied_shapes.write[slot] = points;
+			applied_hashes.write[slot] = _hash_points(points);
+			u[slot] = true;
+		} else {
+			parent->shape_owner_add_shape(owner_id, _create_shape(points));
+			applied_shapes.push_back(points);
+			applied_hashes.push_back(_hash_points(points));
+		}
+	}
+	// Remove shapes which are no longer needed, indices of the shapes
+	// following the removed one are shifted down.
+	for (int i = applied_count - 1; i >= 0; --i) {
+		if (!u[i]) {
+			parent->shape_owner_remove_shape(owner_id, i);
+			applied_shapes.remove(i);
+			applied_hashes.remove(i);
+		}
 	}
 }
 
@@ -65,6 +165,7 @@ void PolyCollisionShape2D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_PARENTED: {
 			parent = Object::cast_to<CollisionObject2D>(get_parent());
+			_clear_applied_shapes();
 			if (parent) {
 				owner_id = parent->create_shape_owner(this);
 				// Shapes are applied in NOTIFICATION_READY, not here.
@@ -93,6 +194,7 @@ void PolyCollisionShape2D::_notification(int p_what) {
 			}
 			owner_id = 0;
 			parent = nullptr;
+			_clear_applied_shapes();
 		} break;
 	}
 }
@@ -14,6 +14,16 @@ protected:
 	float one_way_collision_margin = 1.0;
 	void _update_in_shape_owner(bool p_xform_only = false);
 
+	// Points of each shape added to the shape owner, so that shapes which
+	// did not change can be kept as is, and others can be updated in place.
+	Vector<Vector<Point2>> applied_shapes;
+	Vector<uint32_t> applied_hashes;
+	bool applied_segments = false;
+
+	Ref<Shape2D> _create_shape(const Vector<Point2> &p_points) const;
+	void _update_shape(const Ref<Shape2D> &p_shape, const Vector<Point2> &p_points) const;
+	void _clear_applied_shapes();
+
 protected:
 	void _notification(int p_what);
 	static void _bind_methods();
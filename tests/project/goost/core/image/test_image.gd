@@ -28,6 +28,58 @@ func test_replace_color():
 	output.unlock()
 
 
+func test_replace_color_tolerance():
+	var input = Image.new()
+	input.create(3, 1, false, Image.FORMAT_RGBA8)
+	input.lock()
+	input.set_pixel(0, 0, Color8(200, 0, 0))
+	input.set_pixel(1, 0, Color8(210, 0, 0))
+	input.set_pixel(2, 0, Color8(230, 0, 0))
+	input.unlock()
+
+	GoostImage.replace_color(input, Color8(200, 0, 0), Color.blue)
+	input.lock()
+	assert_eq(input.get_pixel(0, 0), Color.blue)
+	assert_eq(input.get_pixel(1, 0), Color8(210, 0, 0))
+	input.unlock()
+
+	GoostImage.replace_color(input, Color8(220, 0, 0), Color.green, 10 / 255.0)
+	input.lock()
+	assert_eq(input.get_pixel(0, 0), Color.blue)
+	assert_eq(input.get_pixel(1, 0), Color.green)
+	assert_eq(input.get_pixel(2, 0), Color.green)
+	input.unlock()
+
+
+func test_replace_colors():
+	var input = Image.new()
+	input.create(4, 1, false, Image.FORMAT_RGB8)
+	input.lock()
+	input.set_pixel(0, 0, Color.red)
+	input.set_pixel(1, 0, Color.green)
+	input.set_pixel(2, 0, Color.blue)
+	input.set_pixel(3, 0, Color.white)
+	input.unlock()
+
+	GoostImage.replace_colors(input,
+			[Color.red, Color.green, Color.blue, Color(1, 1, 1, 0.5)],
+			[Color.green, Color.blue, Color.red, Color.black])
+	input.lock()
+	assert_eq(input.get_pixel(0, 0), Color.green)
+	assert_eq(input.get_pixel(1, 0), Color.blue)
+	assert_eq(input.get_pixel(2, 0), Color.red)
+	assert_eq(input.get_pixel(3, 0), Color.white, "Images without alpha channel have no translucent pixels.")
+	input.unlock()
+
+	var lum = Image.new()
+	lum.create(2, 1, false, Image.FORMAT_L8)
+	lum.fill(Color.white)
+	GoostImage.replace_colors(lum, [Color.red, Color.white], [Color.white, Color.black])
+	lum.lock()
+	assert_eq(lum.get_pixel(0, 0), Color.black)
+	lum.unlock()
+
+
 func test_resize_hqx2_rgb():
 	var input = TestUtils.image_load(SAMPLES.rect_rgb)
 	var input_size = input.get_size()
@@ -481,6 +533,91 @@ func test_bucket_fill_8_connected():
 	filled.unlock()
 
 
+func test_bucket_fill_tolerance():
+	var input = Image.new()
+	input.create(8, 1, false, Image.FORMAT_RGBA8)
+	input.lock()
+	for x in 8:
+		input.set_pixel(x, 0, Color8(100 + x * 10, 0, 0))
+	input.unlock()
+
+	var mask = GoostImage.bucket_fill_mask(input, Vector2(0, 0))
+	mask.lock()
+	assert_eq(mask.get_format(), Image.FORMAT_L8)
+	assert_eq(mask.get_pixel(0, 0), Color.white)
+	assert_eq(mask.get_pixel(1, 0), Color.black)
+	mask.unlock()
+
+	mask = GoostImage.bucket_fill_mask(input, Vector2(0, 0), GoostImage.FOUR_CONNECTED, 30 / 255.0)
+	mask.lock()
+	for x in 4:
+		assert_eq(mask.get_pixel(x, 0), Color.white)
+	assert_eq(mask.get_pixel(4, 0), Color.black)
+	mask.unlock()
+
+	var _filled = GoostImage.bucket_fill(input, Vector2(7, 0), Color.blue, true, GoostImage.FOUR_CONNECTED, 20 / 255.0)
+	input.lock()
+	assert_eq(input.get_pixel(7, 0), Color.blue)
+	assert_eq(input.get_pixel(5, 0), Color.blue)
+	assert_eq(input.get_pixel(4, 0), Color8(140, 0, 0))
+	input.unlock()
+
+
+func test_bucket_fill_single_pixel():
+	var input = Image.new()
+	input.create(3, 3, false, Image.FORMAT_L8)
+	input.fill(Color.white)
+	input.lock()
+	input.set_pixel(1, 1, Color.black)
+	input.unlock()
+	var _filled = GoostImage.bucket_fill(input, Vector2(1, 1), Color.white)
+	input.lock()
+	assert_eq(input.get_pixel(1, 1), Color.white)
+	input.unlock()
+
+
+func test_bucket_fill_float_format():
+	var input = Image.new()
+	input.create(4, 4, false, Image.FORMAT_RGBAF)
+	input.fill(Color(0.5, 0.5, 0.5))
+	var filled = GoostImage.bucket_fill(input, Vector2(0, 0), Color.red, false)
+	filled.lock()
+	assert_eq(filled.get_pixel(3, 3), Color.red)
+	filled.unlock()
+
+
+func _process_per_pixel(input):
+	var replaced = input.duplicate()
+	GoostImage.replace_color(replaced, Color.transparent, Color.white, 0.1)
+	var binary = input.duplicate()
+	GoostImage.binarize(binary, 0.5)
+	var average = GoostImage.get_pixel_average(input, Rect2(10, 20, 550, 400))
+	return [replaced, binary, average]
+
+
+func test_parallel_per_pixel():
+	var input = TestUtils.image_load(SAMPLES.icon)
+	input.resize(600, 500)
+
+	var max_threads = ProjectSettings.get_setting("goost/image/max_threads")
+	ProjectSettings.set_setting("goost/image/max_threads", 1)
+	var expected = _process_per_pixel(input)
+	ProjectSettings.set_setting("goost/image/max_threads", 0)
+	var result = _process_per_pixel(input)
+	ProjectSettings.set_setting("goost/image/max_threads", max_threads)
+
+	assert_eq(result[0].get_data(), expected[0].get_data())
+	assert_eq(result[1].get_data(), expected[1].get_data())
+	assert_eq(result[2], expected[2])
+
+	# Binarization with a fixed threshold must match Leptonica.
+	var pix = ImagePix.new()
+	pix.create_from_image(input)
+	pix.binarize(0.5)
+	output = result[1]
+	assert_eq(output.get_data(), pix.get_image().get_data())
+
+
 class TestInvalidData extends "res://addons/gut/test.gd":
 	func before_all():
 		Engine.print_error_messages = false
@@ -492,7 +629,9 @@ class TestInvalidData extends "res://addons/gut/test.gd":
 		var image = null
 
 		GoostImage.replace_color(image, Color.red, Color.blue)
+		GoostImage.replace_colors(image, [Color.red], [Color.blue])
 		var _filled = GoostImage.bucket_fill(image, Vector2(), Color())
+		var _mask = GoostImage.bucket_fill_mask(image, Vector2())
 		GoostImage.resize_hqx(image, 9000)
 		GoostImage.rotate(image, -9000, true)
 		GoostImage.rotate_90(image, -1)
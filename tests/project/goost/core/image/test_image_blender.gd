@@ -33,6 +33,27 @@ func test_blend_rect():
 	output.unlock()
 
 
+func test_blend_rect_parallel():
+	var image_blender = ImageBlender.new()
+	image_blender.rgb_equation = ImageBlender.FUNC_MAX
+
+	var input = TestUtils.image_load(SAMPLES.icon)
+	input.resize(400, 300)
+	var dst = TestUtils.image_load(SAMPLES.rect_rgba)
+	dst.resize(500, 400)
+	var expected = dst.duplicate()
+	output = dst
+
+	var max_threads = ProjectSettings.get_setting("goost/image/max_threads")
+	ProjectSettings.set_setting("goost/image/max_threads", 1)
+	image_blender.blend_rect(input, Rect2(Vector2(), input.get_size()), expected, Vector2(30, 60))
+	ProjectSettings.set_setting("goost/image/max_threads", 0)
+	image_blender.blend_rect(input, Rect2(Vector2(), input.get_size()), output, Vector2(30, 60))
+	ProjectSettings.set_setting("goost/image/max_threads", max_threads)
+
+	assert_eq(output.get_data(), expected.get_data())
+
+
 func test_stamp_rect():
 	var image_blender = ImageBlender.new()
 	
@@ -62,6 +83,28 @@ func test_stamp_rect():
 	output.unlock()
 
 
+func test_stamp_rect_parallel():
+	var image_blender = ImageBlender.new()
+	image_blender.rgb_equation = ImageBlender.FUNC_MAX
+
+	var input = TestUtils.image_load(SAMPLES.icon)
+	input.resize(300, 300)
+	var dst = TestUtils.image_load(SAMPLES.rect_rgba)
+	dst.resize(800, 400)
+	var expected = dst.duplicate()
+	output = dst
+
+	var src_rect = Rect2(Vector2(), input.get_size())
+	var max_threads = ProjectSettings.get_setting("goost/image/max_threads")
+	ProjectSettings.set_setting("goost/image/max_threads", 1)
+	image_blender.stamp_rect(input, src_rect, expected, Vector2(150, 200), Vector2(650, 200), 100)
+	ProjectSettings.set_setting("goost/image/max_threads", 0)
+	image_blender.stamp_rect(input, src_rect, output, Vector2(150, 200), Vector2(650, 200), 100)
+	ProjectSettings.set_setting("goost/image/max_threads", max_threads)
+
+	assert_eq(output.get_data(), expected.get_data())
+
+
 func test_blend_equations():
 	var image_blender = ImageBlender.new()
 	
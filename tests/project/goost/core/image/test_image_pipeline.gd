@@ -0,0 +1,144 @@
+extends "res://addons/gut/test.gd"
+
+const SAMPLES = {
+	icon = "res://goost/core/image/samples/icon.png",
+	rect_rgb = "res://goost/core/image/samples/rect_rgb.png",
+	stroke = "res://goost/core/image/samples/stroke.png",
+}
+var output
+
+
+func after_each():
+	if output:
+		output.save_png("res://out/%s.png" % [gut._current_test.name])
+
+
+func assert_images_eq(a, b):
+	assert_eq(a.get_size(), b.get_size())
+	assert_eq(a.get_format(), b.get_format())
+	assert_eq(a.get_data(), b.get_data())
+
+
+func test_empty():
+	var input = TestUtils.image_load(SAMPLES.icon)
+	var pipeline = ImagePipeline.new()
+	output = pipeline.process(input)
+	assert_ne(output, input)
+	assert_images_eq(output, input)
+
+
+func test_replace_color():
+	var input = TestUtils.image_load(SAMPLES.rect_rgb)
+	var pipeline = ImagePipeline.new()
+	pipeline.add_replace_color(Color.red, Color.blue)
+	pipeline.add_replace_color(Color.blue, Color.green, 0.1)
+	output = pipeline.process(input)
+
+	var expected = input.duplicate()
+	GoostImage.replace_color(expected, Color.red, Color.blue)
+	GoostImage.replace_color(expected, Color.blue, Color.green, 0.1)
+	assert_images_eq(output, expected)
+
+
+func test_fused_binarize():
+	var input = TestUtils.image_load(SAMPLES.icon)
+	var data = input.get_data()
+
+	var pipeline = ImagePipeline.new()
+	pipeline.add_replace_color(Color(0, 0, 0, 0), Color.white)
+	pipeline.add_binarize(0.5)
+	pipeline.add_replace_color(Color.black, Color.white)
+	pipeline.add_binarize(0.5, true)
+	output = pipeline.process(input)
+	assert_eq(input.get_data(), data, "Should not modify the original image.")
+
+	var expected = input.duplicate()
+	GoostImage.replace_color(expected, Color(0, 0, 0, 0), Color.white)
+	GoostImage.binarize(expected, 0.5)
+	GoostImage.replace_color(expected, Color.black, Color.white)
+	GoostImage.binarize(expected, 0.5, true)
+	assert_eq(output.get_format(), Image.FORMAT_L8)
+	assert_images_eq(output, expected)
+
+
+func test_leptonica_steps():
+	var input = TestUtils.image_load(SAMPLES.stroke)
+	var pipeline = ImagePipeline.new()
+	pipeline.add_binarize()
+	pipeline.add_morph(GoostImage.MORPH_DILATE, Vector2(5, 3))
+	pipeline.add_rotate(PI / 6)
+	pipeline.add_replace_color(Color.white, Color.red)
+	output = pipeline.process(input)
+
+	var expected = input.duplicate()
+	GoostImage.binarize(expected)
+	GoostImage.morph(expected, GoostImage.MORPH_DILATE, Vector2(5, 3))
+	GoostImage.rotate(expected, PI / 6)
+	GoostImage.replace_color(expected, Color.white, Color.red)
+	assert_images_eq(output, expected)
+
+
+func test_tile_and_blend():
+	var input = TestUtils.image_load(SAMPLES.icon)
+	var stamp = TestUtils.image_load(SAMPLES.rect_rgb)
+	var pipeline = ImagePipeline.new()
+	pipeline.add_tile(Vector2(100, 80), GoostImage.TILE_FLIP_X)
+	pipeline.add_blend(stamp, Vector2(10, 20))
+	pipeline.add_binarize(0.25)
+	output = pipeline.process(input)
+
+	var expected = GoostImage.tile(input, Vector2(100, 80), GoostImage.TILE_FLIP_X)
+	var src = stamp.duplicate()
+	src.convert(expected.get_format())
+	expected.blend_rect(src, Rect2(Vector2(), src.get_size()), Vector2(10, 20))
+	GoostImage.binarize(expected, 0.25)
+	assert_images_eq(output, expected)
+
+
+func test_steps():
+	var pipeline = ImagePipeline.new()
+	pipeline.add_replace_color(Color.red, Color.blue)
+	pipeline.add_rotate(PI)
+	pipeline.add_tile(Vector2(64, 64))
+	assert_eq(pipeline.get_step_count(), 3)
+	assert_eq(pipeline.get_step_type(1), ImagePipeline.STEP_ROTATE)
+
+	var steps = pipeline.steps
+	assert_almost_eq(steps[1].angle, PI, 0.0001)
+	assert_eq(steps[2].size, Vector2(64, 64))
+
+	var copy = ImagePipeline.new()
+	copy.steps = steps
+	assert_eq(copy.get_step_count(), 3)
+
+	var input = TestUtils.image_load(SAMPLES.icon)
+	assert_images_eq(copy.process(input), pipeline.process(input))
+
+	copy.steps = [{type = ImagePipeline.STEP_BINARIZE}]
+	assert_eq(copy.get_step_type(0), ImagePipeline.STEP_BINARIZE)
+	assert_eq(copy.steps[0].threshold, -1.0)
+
+	pipeline.remove_step(0)
+	assert_eq(pipeline.get_step_type(0), ImagePipeline.STEP_ROTATE)
+	pipeline.clear_steps()
+	assert_eq(pipeline.get_step_count(), 0)
+
+
+class TestInvalidData extends "res://addons/gut/test.gd":
+	func before_all():
+		Engine.print_error_messages = false
+
+	func after_all():
+		Engine.print_error_messages = true
+
+	func test_invalid():
+		var pipeline = ImagePipeline.new()
+		assert_null(pipeline.process(null))
+		assert_null(pipeline.process(Image.new()))
+
+		pipeline.add_tile(Vector2(0, 10))
+		pipeline.add_blend(null)
+		assert_eq(pipeline.get_step_count(), 0)
+
+		pipeline.steps = [null, {type = -1}, {type = ImagePipeline.STEP_MAX}]
+		assert_eq(pipeline.get_step_count(), 0)
@@ -0,0 +1,130 @@
+extends "res://addons/gut/test.gd"
+
+const SAMPLES = {
+	icon = "res://goost/core/image/samples/icon.png",
+	rect_rgb = "res://goost/core/image/samples/rect_rgb.png",
+	stroke = "res://goost/core/image/samples/stroke.png",
+}
+var output
+
+
+func after_each():
+	if output:
+		output.save_png("res://out/%s.png" % [gut._current_test.name])
+
+
+func assert_images_eq(a, b):
+	assert_eq(a.get_size(), b.get_size())
+	assert_eq(a.get_format(), b.get_format())
+	assert_eq(a.get_data(), b.get_data())
+
+
+func test_create_from_image():
+	var input = TestUtils.image_load(SAMPLES.rect_rgb)
+	var format = input.get_format()
+	var pix = ImagePix.new()
+	assert_true(pix.empty())
+	pix.create_from_image(input)
+	assert_false(pix.empty())
+	assert_eq(input.get_format(), format, "Should not modify the original image.")
+	assert_eq(pix.get_size(), input.get_size())
+	output = pix.get_image()
+	input.convert(Image.FORMAT_RGBA8)
+	assert_images_eq(output, input)
+
+
+func test_pipeline():
+	var input = TestUtils.image_load(SAMPLES.stroke)
+
+	var expected = input.duplicate()
+	GoostImage.rotate_90(expected, GoostImage.CW)
+	GoostImage.dilate(expected)
+	var expected_centroid = GoostImage.get_centroid(expected)
+
+	var pix = ImagePix.new()
+	pix.create_from_image(input)
+	pix.rotate_90(GoostImage.CW)
+	pix.dilate()
+	assert_eq(pix.get_centroid(), expected_centroid)
+
+	output = pix.get_image()
+	assert_images_eq(output, expected)
+
+
+func test_morph_then_rotate():
+	var input = TestUtils.image_load(SAMPLES.icon)
+
+	var expected = input.duplicate()
+	GoostImage.dilate(expected)
+	GoostImage.rotate(expected, PI / 6)
+
+	var pix = ImagePix.new()
+	pix.create_from_image(input)
+	pix.dilate()
+	pix.rotate(PI / 6)
+	output = pix.get_image()
+	assert_images_eq(output, expected)
+
+
+func test_binarize():
+	var input = TestUtils.image_load(SAMPLES.icon)
+	var expected = input.duplicate()
+	GoostImage.binarize(expected, 0.85)
+
+	var pix = ImagePix.new()
+	pix.create_from_image(input)
+	pix.binarize(0.85)
+	output = pix.get_image()
+	assert_eq(output.get_format(), Image.FORMAT_L8)
+	assert_images_eq(output, expected)
+
+
+func test_binarize_then_dilate():
+	var input = TestUtils.image_load(SAMPLES.stroke)
+	var expected = input.duplicate()
+	GoostImage.binarize(expected)
+	GoostImage.dilate(expected)
+	expected.convert(Image.FORMAT_L8)
+
+	var pix = ImagePix.new()
+	pix.create_from_image(input)
+	pix.binarize()
+	pix.dilate()
+	output = pix.get_image()
+	assert_eq(output.get_format(), Image.FORMAT_L8, "Should not convert grayscale to color.")
+	assert_images_eq(output, expected)
+
+
+func test_get_pixel_average():
+	var input = TestUtils.image_load(SAMPLES.icon)
+	var pix = ImagePix.new()
+	pix.create_from_image(input)
+	var rect = Rect2(8, 8, 32, 32)
+	assert_eq(pix.get_pixel_average(rect), GoostImage.get_pixel_average(input, rect))
+
+	var mask = ImagePix.new()
+	mask.create_from_image(input)
+	mask.binarize(0.85)
+	var mask_image = input.duplicate()
+	GoostImage.binarize(mask_image, 0.85)
+	assert_eq(pix.get_pixel_average(Rect2(), mask), GoostImage.get_pixel_average(input, Rect2(), mask_image))
+
+
+class TestInvalidData extends "res://addons/gut/test.gd":
+	func before_all():
+		Engine.print_error_messages = false
+
+	func after_all():
+		Engine.print_error_messages = true
+
+	func test_empty():
+		var pix = ImagePix.new()
+		pix.create_from_image(null)
+		pix.create_from_image(Image.new())
+		assert_true(pix.empty())
+		assert_null(pix.get_image())
+		pix.rotate(PI)
+		pix.binarize()
+		pix.dilate()
+		assert_eq(pix.get_centroid(), Vector2())
+		assert_eq(pix.get_size(), Vector2())
@@ -22,6 +22,12 @@ func test_create_local_instance():
 	local.parameters.strictly_simple = true
 
 
+func test_parameters_not_modified():
+	var local = PolyBoolean2D.new_instance()
+	local.clip_polylines_with_polygons([poly_a, poly_c], [poly_b, poly_d])
+	assert_false(local.parameters.subject_open)
+
+
 func test_merge_polygons():
 	solution = PolyBoolean2D.merge_polygons([poly_a, poly_b, poly_c, poly_d])
 	assert_eq(solution.size(), 1)
@@ -42,6 +48,24 @@ func test_intersect_polygons():
 	assert_eq(solution[2].size(), 4)
 
 
+func test_disjoint_polygons():
+	var far = Transform2D(0, Vector2.ONE * SIZE * 10).xform(poly_a)
+	# Subject polygons should be processed the same way as with no clip polygons.
+	solution = PolyBoolean2D.clip_polygons([poly_a], [far])
+	assert_eq(solution, PolyBoolean2D.clip_polygons([poly_a], []))
+	var local = PolyBoolean2D.new_instance()
+	local.parameters.reverse_solution = true
+	solution = local.clip_polygons([poly_a, PoolVector2Array()], [far])
+	assert_eq(solution, local.clip_polygons([poly_a], []))
+	solution = PolyBoolean2D.intersect_polygons([poly_a], [far])
+	assert_eq(solution, [])
+	# Only the overlapping clip polygon should take effect.
+	solution = PolyBoolean2D.clip_polygons([poly_a, poly_b], [far, poly_c, poly_d])
+	assert_eq(solution, PolyBoolean2D.clip_polygons([poly_a, poly_b], [poly_c, poly_d]))
+	solution = PolyBoolean2D.intersect_polylines_with_polygons([poly_a], [far])
+	assert_eq(solution, [])
+
+
 func test_exclude_polygons():
 	solution = PolyBoolean2D.exclude_polygons([poly_a, poly_b], [poly_c, poly_d])
 	assert_eq(solution.size(), 2)
@@ -55,6 +79,20 @@ func test_boolean_polygons():
 	assert_eq(solution[0].size(), 16)
 
 
+func test_boolean_polygons_batch():
+	var jobs = []
+	for i in 16:
+		jobs.push_back([[poly_a, poly_b], [poly_c, poly_d], PolyBoolean2D.OP_UNION])
+		jobs.push_back([[poly_a, poly_b], [poly_c, poly_d], PolyBoolean2D.OP_DIFFERENCE])
+	solution = PolyBoolean2D.boolean_polygons_batch(jobs)
+	assert_eq(solution.size(), jobs.size())
+	for i in range(0, solution.size(), 2):
+		assert_eq(solution[i].size(), 1)
+		assert_eq(solution[i][0].size(), 16)
+		assert_eq(solution[i + 1].size(), 1)
+		assert_eq(solution[i + 1][0].size(), 10)
+
+
 func test_boolean_polygons_tree():
 	var a = GoostGeometry2D.regular_polygon(4, 150)
 	var b = GoostGeometry2D.regular_polygon(4, 100)
@@ -82,3 +120,76 @@ func test_intersect_polylines_with_polygons():
 	assert_eq(solution[0].size(), 3)
 	assert_eq(solution[1].size(), 2)
 	assert_eq(solution[2].size(), 3)
+
+
+func test_merge_polygons_cascaded():
+	var tile = PoolVector2Array([Vector2(0, 0), Vector2(10, 0), Vector2(10, 10), Vector2(0, 10)])
+	var tiles = []
+	for y in 20:
+		for x in 20:
+			if x == 10 and y == 10:
+				continue # Hole.
+			tiles.push_back(Transform2D(0, Vector2(x, y) * 10).xform(tile))
+	var expected = PolyBoolean2D.merge_polygons(tiles)
+	solution = PolyBoolean2D.merge_polygons_cascaded(tiles)
+	assert_eq(solution.size(), 2, "Expected outer boundary and a hole.")
+	assert_same_area(solution, expected)
+
+	solution = PolyBoolean2D.merge_polygons_cascaded(tiles, 25.0)
+	assert_eq(solution.size(), 2)
+	assert_same_area(solution, expected)
+
+	# Overlapping polygons produce holes with the even-odd fill rule.
+	var local = PolyBoolean2D.new_instance()
+	local.parameters.subject_fill_rule = PolyBooleanParameters2D.FILL_RULE_EVEN_ODD
+	var overlapping = []
+	for t in tiles:
+		overlapping.push_back(Transform2D(0, Vector2(5, 5)).xform(t))
+	tiles.append_array(overlapping)
+	solution = local.merge_polygons_cascaded(tiles)
+	assert_same_area(solution, local.merge_polygons(tiles))
+
+
+func test_merge_polygons_cascaded_mixed_orientation():
+	var tile = PoolVector2Array([Vector2(0, 0), Vector2(10, 0), Vector2(10, 10), Vector2(0, 10)])
+	var reversed = tile
+	reversed.invert()
+	var tiles = []
+	for y in 20:
+		for x in 20:
+			tiles.push_back(Transform2D(0, Vector2(x, y) * 10).xform(tile))
+	# Cancel out a few tiles far from each other with the non-zero fill rule.
+	for cell in [Vector2(1, 1), Vector2(18, 2), Vector2(10, 17)]:
+		tiles.push_back(Transform2D(0, cell * 10).xform(reversed))
+	var expected = PolyBoolean2D.merge_polygons(tiles)
+	assert_eq(expected.size(), 4, "Expected outer boundary and three holes.")
+	solution = PolyBoolean2D.merge_polygons_cascaded(tiles)
+	assert_eq(solution.size(), expected.size())
+	assert_same_area(solution, expected)
+
+
+func assert_same_area(polygons, expected):
+	var area = 0.0
+	for p in polygons:
+		area += GoostGeometry2D.polygon_area(p)
+	var expected_area = 0.0
+	for p in expected:
+		expected_area += GoostGeometry2D.polygon_area(p)
+	assert_almost_eq(area, expected_area, 0.01)
+
+	# Sample points near the corners of tiles.
+	var mismatches = 0
+	for y in 41:
+		for x in 41:
+			var point = Vector2(x, y) * 5.0 + Vector2(1, 1)
+			if contains_point(polygons, point) != contains_point(expected, point):
+				mismatches += 1
+	assert_eq(mismatches, 0)
+
+
+func contains_point(polygons, point):
+	var inside = false
+	for p in polygons:
+		if GoostGeometry2D.point_in_polygon(point, p) > 0:
+			inside = not inside
+	return inside
@@ -84,12 +84,151 @@ func test_decompose_polygons_triangles_mono():
 	assert_eq(solution[11].size(), 3)
 
 
+func test_triangulate_polygons_cdt():
+	var backend = PolyDecomp2D.get_backend_name()
+	PolyDecomp2D.set_backend_name("cdt:polypartition")
+
+	solution = PolyDecomp2D.decompose_polygons([poly_boundary, poly_hole], PolyDecomp2D.DECOMP_TRIANGLES_EC)
+	assert_eq(solution.size(), 12)
+	var expected = GoostGeometry2D.polygon_area(poly_boundary) + GoostGeometry2D.polygon_area(poly_hole)
+	assert_almost_eq(triangles_area(solution), expected, 0.01)
+
+	# Many merge vertices, each tooth is a separate monotone piece.
+	var comb = [Vector2(0, 0), Vector2(100, 0), Vector2(100, 10)]
+	for i in range(9, -1, -1):
+		var x = i * 10
+		comb.append_array([Vector2(x + 8, 10), Vector2(x + 8, 60), Vector2(x + 2, 60), Vector2(x + 2, 10)])
+	comb.push_back(Vector2(0, 10))
+	solution = PolyDecomp2D.decompose_polygons([PoolVector2Array(comb)], PolyDecomp2D.DECOMP_TRIANGLES_MONO)
+	assert_almost_eq(triangles_area(solution), 4000.0, 0.01)
+
+	# Touching along the long diagonal of a rhombus, which must not be flipped.
+	var left = PoolVector2Array([Vector2(0, 0), Vector2(20, -100), Vector2(20, 100)])
+	var right = PoolVector2Array([Vector2(20, -100), Vector2(40, 0), Vector2(20, 100)])
+	assert_false(Geometry.is_polygon_clockwise(left) or Geometry.is_polygon_clockwise(right))
+	solution = PolyDecomp2D.decompose_polygons([left, right], PolyDecomp2D.DECOMP_TRIANGLES_EC)
+	assert_eq(solution.size(), 2)
+	for tri in solution:
+		var on_left = tri[0].x <= 20 and tri[1].x <= 20 and tri[2].x <= 20
+		var on_right = tri[0].x >= 20 and tri[1].x >= 20 and tri[2].x >= 20
+		assert_true(on_left or on_right, "Input edges should be kept.")
+
+	PolyDecomp2D.set_backend_name(backend)
+
+
+func test_triangulate_polygons_cdt_delaunay():
+	var backend = PolyDecomp2D.get_backend_name()
+	PolyDecomp2D.set_backend_name("cdt:polypartition")
+
+	# Convex, so that constrained triangulation is the same as Delaunay one.
+	var polygon = PoolVector2Array([Vector2(0, 0), Vector2(100, -10), Vector2(180, 20), Vector2(220, 90),
+			Vector2(190, 170), Vector2(90, 200), Vector2(10, 150), Vector2(-30, 70)])
+	solution = PolyDecomp2D.decompose_polygons([polygon], PolyDecomp2D.DECOMP_TRIANGLES_EC)
+	assert_eq(solution.size(), 6)
+	assert_almost_eq(triangles_area(solution), GoostGeometry2D.polygon_area(polygon), 0.01)
+
+	for tri in solution:
+		var center = circumcenter(tri[0], tri[1], tri[2])
+		var radius = center.distance_to(tri[0])
+		for p in polygon:
+			if p in tri:
+				continue
+			assert_gt(center.distance_to(p), radius - 0.001, "Circumcircle should be empty.")
+
+	PolyDecomp2D.set_backend_name(backend)
+
+
+func triangles_area(triangles):
+	var area = 0.0
+	for tri in triangles:
+		assert_eq(tri.size(), 3)
+		area += GoostGeometry2D.polygon_area(tri)
+	return area
+
+
+func circumcenter(a, b, c):
+	var d = 2.0 * (a.x * (b.y - c.y) + b.x * (c.y - a.y) + c.x * (a.y - b.y))
+	var a2 = a.length_squared()
+	var b2 = b.length_squared()
+	var c2 = c.length_squared()
+	return Vector2(
+			(a2 * (b.y - c.y) + b2 * (c.y - a.y) + c2 * (a.y - b.y)) / d,
+			(a2 * (c.x - b.x) + b2 * (a.x - c.x) + c2 * (b.x - a.x)) / d)
+
+
 func test_decompose_polygons_convex_opt():
 	solution = PolyDecomp2D.decompose_polygons([poly_boundary], PolyDecomp2D.DECOMP_CONVEX_OPT)
 	assert_eq(solution.size(), 1)
 	assert_eq(solution[0].size(), 8)
 
 
+func test_decompose_polygons_convex_approx():
+	# A square with a shallow notch.
+	var notched = PoolVector2Array([Vector2(0, 0), Vector2(50, 2), Vector2(100, 0), Vector2(100, 100), Vector2(0, 100)])
+	var pd = PolyDecomp2D.new_instance()
+
+	pd.parameters.concavity = 0.5
+	solution = pd.decompose_polygons([notched], PolyDecomp2D.DECOMP_CONVEX_APPROX)
+	assert_eq(solution.size(), 2)
+
+	pd.parameters.concavity = 4.0
+	solution = pd.decompose_polygons([notched], PolyDecomp2D.DECOMP_CONVEX_APPROX)
+	assert_eq(solution.size(), 1)
+	assert_eq(solution[0].size(), 4)
+
+	pd.parameters.concavity = 0.0
+	pd.parameters.max_pieces = 1
+	solution = pd.decompose_polygons([notched], PolyDecomp2D.DECOMP_CONVEX_APPROX)
+	assert_eq(solution.size(), 1)
+
+	# The limit applies to all polygons, even if large input is split into groups.
+	var polygons = []
+	for i in 250:
+		polygons.push_back(Transform2D(0, Vector2(i * 200, 0)).xform(notched))
+	pd.parameters.max_pieces = 300
+	solution = pd.decompose_polygons(polygons, PolyDecomp2D.DECOMP_CONVEX_APPROX)
+	assert_eq(solution.size(), 300)
+
+
+func test_decompose_polygons_convex_approx_no_overlap():
+	# A square with a deep notch, and a tab reaching into the notch, so that
+	# merging some of the pieces would cover the others.
+	var tabbed = PoolVector2Array([
+		Vector2(0, 0), Vector2(30, 0), Vector2(30, 70), Vector2(70, 70),
+		Vector2(70, 20), Vector2(45, 20), Vector2(45, 5), Vector2(70, 5),
+		Vector2(70, 0), Vector2(100, 0), Vector2(100, 100), Vector2(0, 100)])
+	var pd = PolyDecomp2D.new_instance()
+	pd.parameters.concavity = 0.0
+	pd.parameters.max_pieces = 1
+	solution = pd.decompose_polygons([tabbed], PolyDecomp2D.DECOMP_CONVEX_APPROX)
+
+	for i in solution.size():
+		for j in range(i + 1, solution.size()):
+			var overlap = PolyBoolean2D.intersect_polygons([solution[i]], [solution[j]])
+			var area = 0.0
+			for poly in overlap:
+				area += abs(GoostGeometry2D.polygon_area(poly))
+			assert_almost_eq(area, 0.0, 0.01)
+
+
+func test_decompose_polygons_islands():
+	# Enough disjoint islands with holes to be decomposed in parallel.
+	var polygons = []
+	for i in 150:
+		var offset = Transform2D(0, Vector2(i * SIZE * 5, 0))
+		polygons.push_back(offset.xform(poly_boundary))
+		polygons.push_back(offset.xform(poly_hole))
+	solution = PolyDecomp2D.decompose_polygons(polygons, PolyDecomp2D.DECOMP_CONVEX_HM)
+	assert_gt(solution.size(), 150)
+	# Pieces are ordered by the islands they belong to.
+	var island = 0
+	for piece in solution:
+		var idx = int(round(GoostGeometry2D.polygon_centroid(piece).x / (SIZE * 5)))
+		assert_true(idx == island or idx == island + 1, "Unexpected order of pieces.")
+		island = idx
+	assert_eq(island, 149)
+
+
 func test_decompose_polygon_empty():
 	Engine.print_error_messages = false
 
@@ -56,6 +56,92 @@ func _on_clip_outlines_updated():
 	remove_child(n)
 
 
+func test_incremental_rebuild():
+	n.points = outer_a
+	var children = []
+	for i in 4:
+		var c = n.new_child(Transform2D(0.0, Vector2(256, 0).rotated(i * PI / 2)).xform(outer_b))
+		c.operation = PolyNode2D.OP_DIFFERENCE
+		children.push_back(c)
+	var outlines = n.build_outlines()
+	assert_eq(outlines.size(), 1)
+
+	# Change a child in the middle, should match a rebuild from scratch.
+	children[2].operation = PolyNode2D.OP_UNION
+	children[2].position = Vector2(0, 64)
+	outlines = n.get_outlines()
+
+	var expected = PolyNode2D.new()
+	expected.points = outer_a
+	for c in children:
+		var e = expected.new_child(c.points)
+		e.operation = c.operation
+		e.transform = c.transform
+	assert_eq(outlines, expected.build_outlines())
+	expected.free()
+
+	# Removed children should no longer contribute.
+	n.remove_child(children[0])
+	children[0].free()
+	assert_ne(n.get_outlines(), outlines)
+
+
+func test_remove_only_child():
+	n.points = outer_a
+	var c = n.new_child(Transform2D(0.0, Vector2(256, 0)).xform(outer_b))
+	c.operation = PolyNode2D.OP_DIFFERENCE
+	assert_eq(n.get_outlines()[0].size(), 12)
+
+	n.remove_child(c)
+	c.free()
+	var outlines = n.get_outlines()
+	assert_eq(outlines.size(), 1)
+	assert_eq(outlines[0], outer_a)
+
+
+func test_async_build():
+	add_child(n)
+	n.async_build = true
+	n.points = outer_a
+	var c = n.new_child(Transform2D(0.0, Vector2(256, 0)).xform(outer_b))
+	c.operation = PolyNode2D.OP_DIFFERENCE
+	yield(n, "outlines_updated")
+
+	var outlines = n.get_outlines()
+	assert_eq(outlines.size(), 1)
+	assert_eq(outlines[0].size(), 12)
+
+	# Previous outlines are kept until new ones are built.
+	c.operation = PolyNode2D.OP_NONE
+	assert_eq(n.get_outlines(), outlines)
+	yield(n, "outlines_updated")
+	assert_eq(n.get_outlines()[0].size(), outer_a.size())
+	remove_child(n)
+
+
+func test_async_build_modified_while_building():
+	add_child(n)
+	n.async_build = true
+	n.points = gen.regular_polygon(1024, 256)
+	var c = n.new_child(Transform2D(0.0, Vector2(256, 0)).xform(gen.regular_polygon(1024, 64)))
+	c.operation = PolyNode2D.OP_DIFFERENCE
+	yield(n, "outlines_updated")
+
+	# Rebuild synchronously while building in the background.
+	c.position = Vector2(0, 64)
+	yield(get_tree(), "idle_frame")
+	c.position = Vector2(0, -64)
+	n.async_build = false
+	var outlines = n.get_outlines()
+
+	# Outdated result of the background build should be discarded.
+	yield(get_tree(), "idle_frame")
+	yield(get_tree(), "idle_frame")
+	assert_eq(n.get_outlines(), outlines)
+	assert_eq(c.get_outlines(), c.build_outlines())
+	remove_child(n)
+
+
 func test_is_hole_empty():
 	assert_true(n.is_inner())	
 
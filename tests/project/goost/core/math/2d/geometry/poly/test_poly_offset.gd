@@ -40,3 +40,47 @@ func test_deflate_polylines():
 	assert_ne(polyofs.parameters.end_type, PolyOffsetParameters2D.END_POLYGON)
 	assert_eq(solution.size(), 1) # Successfully merged together.
 	assert_eq(solution[0].size(), 17)
+
+
+func test_offset_cached():
+	var cache = PolyOffset2D.deflate_polygons_cached([poly_a, poly_c], SIZE)
+	assert_eq(cache.get_max_delta(), SIZE)
+	solution = cache.offset(SIZE / 2.0)
+	var expected = PolyOffset2D.deflate_polygons([poly_a, poly_c], SIZE / 2.0)
+	assert_eq(solution.size(), expected.size())
+	assert_almost_eq(GoostGeometry2D.polygon_area(solution[0]), GoostGeometry2D.polygon_area(expected[0]), 1.0)
+
+	cache = PolyOffset2D.inflate_polygons_cached([poly_a, poly_c], SIZE)
+	solution = cache.offset(SIZE / 4.0)
+	assert_eq(solution.size(), 2)
+	assert_eq(solution[0].size(), 4)
+
+	var zigzag = PoolVector2Array([Vector2(0, 0), Vector2(50, 50), Vector2(100, 0), Vector2(150, 50)])
+	cache = PolyOffset2D.deflate_polylines_cached([zigzag], SIZE)
+	for delta in [1.0, 10.0, 25.0, 50.0]:
+		solution = cache.offset(delta)
+		expected = PolyOffset2D.deflate_polylines([zigzag], delta)
+		assert_eq(solution.size(), 1)
+		assert_almost_eq(GoostGeometry2D.polygon_area(solution[0]), GoostGeometry2D.polygon_area(expected[0]), 1.0)
+
+	assert_eq(cache.offset(0.0).size(), 0, "Polylines have no area.")
+	assert_eq(cache.offset(SIZE), PolyOffset2D.deflate_polylines([zigzag], SIZE))
+
+
+func test_offset_polygons_multi():
+	var deltas = [5.0, 10.0, 20.0]
+	var rings = PolyOffset2D.inflate_polygons_multi([poly_a, poly_c], deltas)
+	assert_eq(rings.size(), deltas.size())
+	for i in deltas.size():
+		var expected = PolyOffset2D.inflate_polygons([poly_a, poly_c], deltas[i])
+		assert_eq(rings[i].size(), expected.size())
+		for j in expected.size():
+			assert_eq(rings[i][j], expected[j])
+
+	rings = PolyOffset2D.deflate_polygons_multi([poly_a], deltas)
+	assert_eq(rings.size(), deltas.size())
+	var area = GoostGeometry2D.polygon_area(poly_a)
+	for polygons in rings:
+		assert_eq(polygons.size(), 1)
+		assert_gt(GoostGeometry2D.polygon_area(polygons[0]), area, "Rings should grow.")
+		area = GoostGeometry2D.polygon_area(polygons[0])
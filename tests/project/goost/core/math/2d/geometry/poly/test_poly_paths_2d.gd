@@ -0,0 +1,47 @@
+extends "res://addons/gut/test.gd"
+
+const SIZE = 50.0
+
+var base_poly = PoolVector2Array([Vector2(-1, -1), Vector2(1, -1), Vector2(1, 1), Vector2(-1, 1)])
+
+var poly_a = Transform2D(0, Vector2.ONE).scaled(Vector2.ONE * SIZE).xform(base_poly)
+var poly_b = Transform2D(0, Vector2.ONE * SIZE).xform(poly_a)
+
+
+func test_polypaths():
+	var paths = PolyPaths2D.new()
+	assert_true(paths.is_empty())
+	paths.polypaths = [poly_a, poly_b]
+	assert_eq(paths.get_path_count(), 2)
+	assert_eq(paths.polypaths[0], poly_a)
+	assert_eq(paths.polypaths[1], poly_b)
+	paths.clear()
+	assert_true(paths.is_empty())
+
+
+func test_chain_operations():
+	var a = PolyPaths2D.new()
+	a.polypaths = [poly_a]
+	var b = PolyPaths2D.new()
+	b.polypaths = [poly_b]
+
+	var merged = PolyBoolean2D.boolean_paths(a, b, PolyBoolean2D.OP_UNION)
+	assert_eq(merged.get_path_count(), 1)
+	assert_eq(merged.polypaths,
+			PolyBoolean2D.boolean_polygons([poly_a], [poly_b], PolyBoolean2D.OP_UNION))
+
+	var grown = PolyOffset2D.deflate_paths(merged, SIZE / 2.0)
+	assert_eq(grown.polypaths,
+			PolyOffset2D.deflate_polygons(merged.polypaths, SIZE / 2.0))
+
+	var triangles = PolyDecomp2D.triangulate_paths(grown)
+	assert_eq(triangles.size(), PolyDecomp2D.triangulate_polygons(grown.polypaths).size())
+	for t in triangles:
+		assert_eq(t.size(), 3)
+
+
+func test_merge_paths():
+	var a = PolyPaths2D.new()
+	a.polypaths = [poly_a, poly_b]
+	var merged = PolyBoolean2D.boolean_paths(a, null, PolyBoolean2D.OP_UNION)
+	assert_eq(merged.get_path_count(), 1)
@@ -79,6 +79,39 @@ func test_deflate_polyline():
 	assert_eq(solution[0].size(), 10)
 
 
+func test_stroke_polyline():
+	var polyline = [Vector2(0, 0), Vector2(100, 0), Vector2(100, 100)]
+	var mesh = GoostGeometry2D.stroke_polyline(polyline, 10)
+	assert_eq(mesh[0].size(), 6)
+	assert_eq(mesh[1].size(), 12)
+	assert_eq(mesh[0][0], Vector2(0, -5))
+	assert_eq(mesh[0][1], Vector2(0, 5))
+	assert_true(mesh[0][2].is_equal_approx(Vector2(105, -5)))
+	assert_true(mesh[0][3].is_equal_approx(Vector2(95, 5)))
+
+	mesh = GoostGeometry2D.stroke_polyline(polyline, 10, true)
+	assert_eq(mesh[0].size(), 6)
+	assert_eq(mesh[1].size(), 18)
+
+	# Duplicate points are skipped.
+	mesh = GoostGeometry2D.stroke_polyline([Vector2(0, 0), Vector2(0, 0), Vector2(100, 0)], 10)
+	assert_eq(mesh[0].size(), 4)
+	assert_eq(mesh[1].size(), 6)
+
+	mesh = GoostGeometry2D.stroke_polyline([Vector2(0, 0), Vector2(100, 0)], 10, true)
+	assert_eq(mesh[0].size(), 0)
+	assert_eq(mesh[1].size(), 0)
+
+
+func test_stroke_polyline_miter_limit():
+	var mesh = GoostGeometry2D.stroke_polyline([Vector2(0, 0), Vector2(100, 0), Vector2(0, 1)], 10)
+	var corner = Vector2(100, 0)
+	for i in [2, 3]:
+		var d = mesh[0][i].distance_to(corner)
+		assert_gt(d, 5.0)
+		assert_lt(d, 20.0 + 0.001, "Should be clamped to 4 times the half width.")
+
+
 func test_triangulate_polygon():
 	solution = GoostGeometry2D.triangulate_polygon(poly_boundary)
 	assert_eq(solution.size(), 6)
@@ -119,6 +152,19 @@ func test_point_in_polygon():
 	assert_eq(solution, -1) # exactly
 
 
+func test_points_in_polygon():
+	var points = PoolVector2Array([Vector2(50, 50), Vector2(-50, 50), Vector2(0, 50)])
+	for i in 200:
+		points.push_back(Vector2(i - 50, i * 0.5))
+	solution = GoostGeometry2D.points_in_polygon(points, poly_a)
+	assert_eq(solution.size(), points.size())
+	assert_eq(solution[0], 1)
+	assert_eq(solution[1], 0)
+	assert_eq(solution[2], -1)
+	for i in points.size():
+		assert_eq(solution[i], GoostGeometry2D.point_in_polygon(points[i], poly_a))
+
+
 func test_regular_polygon():
 	solution = GoostGeometry2D.regular_polygon(64, SIZE)
 	assert_eq(solution.size(), 64)
@@ -251,6 +297,33 @@ func test_simplify_polyline_zero_epsilon():
 	assert_eq(input.size(), simplified.size())
 
 
+func test_simplify_polylines():
+	var a = [Vector2(20, 51), Vector2(32, 13), Vector2(34, 13), Vector2(37, 13), Vector2(40, 18), Vector2(47, 46)]
+	var b = GoostGeometry2D.circle(64)
+	b.push_back(b[0]) # Closed.
+	var solution = GoostGeometry2D.simplify_polylines([a, b, []], 10.0)
+	assert_eq(solution.size(), 3)
+	assert_eq(solution[0], GoostGeometry2D.simplify_polyline(a, 10.0))
+	assert_eq(solution[1], GoostGeometry2D.simplify_polyline(b, 10.0))
+	assert_gt(solution[1].size(), 2, "Closed polylines should not collapse.")
+	assert_eq(solution[2].size(), 0)
+
+
+func test_decimate_polyline():
+	var input = [Vector2(0, 0), Vector2(10, 1), Vector2(20, 0), Vector2(30, 20), Vector2(40, 0), Vector2(50, 1), Vector2(60, 0)]
+	var decimated = GoostGeometry2D.decimate_polyline(input, 3)
+	assert_eq(decimated, PoolVector2Array([Vector2(0, 0), Vector2(30, 20), Vector2(60, 0)]))
+
+	decimated = GoostGeometry2D.decimate_polyline(input, 5)
+	assert_eq(decimated.size(), 5)
+	assert_eq(decimated[0], input[0])
+	assert_eq(decimated[-1], input[-1])
+	assert_true(Vector2(30, 20) in decimated)
+
+	assert_eq(GoostGeometry2D.decimate_polyline(input, 0).size(), 2)
+	assert_eq(GoostGeometry2D.decimate_polyline(input, 100).size(), input.size())
+
+
 func test_smooth_polygon():
 	var input = [Vector2(26, 20), Vector2(73, 23), Vector2(72, 62), Vector2(29, 57)]
 	var control = [Vector2(26, 20), Vector2(49.311768, 15.934073), Vector2(73, 23),
@@ -279,6 +352,36 @@ func test_smooth_polyline():
 		assert_eq(smoothed[i], control[i])
 
 
+func test_smooth_polygon_adaptive():
+	var input = [Vector2(0, 0), Vector2(100, 0), Vector2(100, 100), Vector2(0, 100)]
+	var smoothed = GoostGeometry2D.smooth_polygon_adaptive(input, 0.5)
+	assert_gt(smoothed.size(), input.size())
+	# Interpolating spline, goes through all input vertices in order.
+	var idx = 0
+	for p in smoothed:
+		if idx < input.size() and p == input[idx]:
+			idx += 1
+	assert_eq(idx, input.size())
+
+	var finer = GoostGeometry2D.smooth_polygon_adaptive(input, 0.05)
+	assert_gt(finer.size(), smoothed.size())
+
+
+func test_smooth_polyline_adaptive():
+	# Straight lines should not be subdivided.
+	var line = [Vector2(0, 0), Vector2(10, 0), Vector2(20, 0), Vector2(30, 0)]
+	var smoothed = GoostGeometry2D.smooth_polyline_adaptive(line, 0.1)
+	assert_eq(smoothed, PoolVector2Array(line))
+
+	var input = [Vector2(25, 83), Vector2(49, 16), Vector2(66, 79), Vector2(100, 80)]
+	smoothed = GoostGeometry2D.smooth_polyline_adaptive(input, 0.25)
+	assert_gt(smoothed.size(), input.size())
+	assert_eq(smoothed[0], input[0])
+	assert_eq(smoothed[-1], input[-1])
+	for p in input:
+		assert_true(p in smoothed)
+
+
 func test_smooth_polygon_approx():
 	var input = [Vector2(25, 83), Vector2(49, 16), Vector2(66, 79)]
 	var control = [Vector2(31, 66.25), Vector2(43, 32.75), Vector2(53.25, 31.75), Vector2(61.75, 63.25), Vector2(55.75, 80), Vector2(35.25, 82)]
@@ -321,6 +424,18 @@ class Stress extends "res://addons/gut/test.gd":
 			time += t2 - t1
 		gut.p(time / 10000.0)
 
+	func test_simplify_polylines():
+		var input = []
+		for i in 1000:
+			var polyline = GoostGeometry2D.circle(64)
+			for j in polyline.size():
+				polyline[j] += Random2D.point_in_circle(10)
+			input.push_back(polyline)
+		var t1 = OS.get_ticks_msec()
+		var _out = GoostGeometry2D.simplify_polylines(input, 100.0)
+		var t2 = OS.get_ticks_msec()
+		gut.p(t2 - t1)
+
 	func test_smooth_polyline():
 		var time = 0
 		var input = GoostGeometry2D.regular_polygon(1024, 6)
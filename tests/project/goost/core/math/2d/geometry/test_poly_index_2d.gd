@@ -0,0 +1,60 @@
+extends "res://addons/gut/test.gd"
+
+var index: PolyIndex2D
+
+
+func before_each():
+	index = PolyIndex2D.new()
+
+
+func test_point_in_polygons():
+	var polygons = []
+	for y in 8:
+		for x in 8:
+			var circle = GoostGeometry2D.circle(20)
+			polygons.push_back(Transform2D(0, Vector2(x, y) * 50).xform(circle))
+	index.polygons = polygons
+	assert_eq(index.get_polygon_count(), 64)
+
+	var points = PoolVector2Array()
+	var rng = RandomNumberGenerator.new()
+	rng.seed = 1
+	for i in 1000:
+		points.push_back(Vector2(rng.randf_range(-50, 400), rng.randf_range(-50, 400)))
+
+	var ids = index.point_in_polygons(points)
+	assert_eq(ids.size(), points.size())
+	for i in points.size():
+		var expected = -1
+		for p in polygons.size():
+			if GoostGeometry2D.point_in_polygon(points[i], polygons[p]) != 0:
+				expected = p
+				break
+		assert_eq(ids[i], expected)
+
+
+func test_find_polygon_overlapping():
+	var a = GoostGeometry2D.regular_polygon(4, 100)
+	var b = GoostGeometry2D.regular_polygon(4, 50)
+	index.polygons = [a, b]
+	assert_eq(index.find_polygon(Vector2()), 0, "Should return the smallest index.")
+	index.polygons = [b, a]
+	assert_eq(index.find_polygon(Vector2()), 0)
+	assert_eq(index.find_polygon(Vector2(90, 0)), 1)
+	assert_eq(index.find_polygon(Vector2(1000, 0)), -1)
+
+
+func test_find_polygon_thin():
+	# Both polygons are in the same leaf, so the point is within the leaf's
+	# rect, but far outside of the rect of the thin polygon.
+	var thin = PoolVector2Array([Vector2(0, 0), Vector2(100, 0), Vector2(100, 1e-7), Vector2(0, 1e-7)])
+	var large = GoostGeometry2D.regular_polygon(4, 1e6)
+	index.polygons = [thin, large]
+	assert_eq(index.find_polygon(Vector2(50, 5e5)), 1)
+	assert_eq(index.find_polygon(Vector2(50, -5e5)), 1)
+	assert_eq(index.find_polygon(Vector2(50, 5e-8)), 0)
+
+
+func test_empty():
+	assert_eq(index.find_polygon(Vector2()), -1)
+	assert_eq(index.point_in_polygons(PoolVector2Array([Vector2()])), PoolIntArray([-1]))
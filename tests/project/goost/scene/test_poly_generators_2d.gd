@@ -100,3 +100,18 @@ func test_poly_path():
 		assert_true(GoostGeometry2D.point_in_polygon(p, deflated) as bool)
 
 	assert_true(GoostGeometry2D.polygon_area(deflated) > 0.0)
+
+	var expected = PolyOffset2D.new_instance()
+	expected.parameters = params
+	assert_eq(outlines, expected.deflate_polylines([c.tessellate()], 32.0))
+
+	# Animate the offset.
+	n.buffer_cached = true
+	assert_eq(n.build_outlines(), outlines, "Should match PolyOffset2D until the offset changes.")
+	var area = GoostGeometry2D.polygon_area(deflated)
+	for offset in [40.0, 48.0, 64.0, 16.0]:
+		n.buffer_offset = offset
+		outlines = n.build_outlines()
+		var control_area = GoostGeometry2D.polygon_area(expected.deflate_polylines([c.tessellate()], offset)[0])
+		assert_almost_eq(GoostGeometry2D.polygon_area(outlines[0]), control_area, control_area * 0.01)
+	assert_true(GoostGeometry2D.polygon_area(outlines[0]) < area)
@@ -19,3 +19,50 @@ func test_collision_shape():
 
 	var shape_count = body.shape_owner_get_shape_count(0)
 	assert_eq(shape_count, 1)
+
+
+func test_collision_shape_async_build():
+	var body = StaticBody2D.new()
+	add_child_autofree(body)
+
+	var shape = PolyCollisionShape2D.new()
+	shape.build_mode = PolyCollisionShape2D.BUILD_TRIANGLES
+	shape.async_build = true
+
+	var circle = PolyCircle2D.new()
+	circle.async_build = true
+	shape.add_child(circle)
+
+	body.add_child(shape)
+	yield(shape, "shapes_applied")
+
+	var shape_count = body.shape_owner_get_shape_count(0)
+	assert_gt(shape_count, 1)
+
+
+func test_collision_shape_reuse():
+	var body = StaticBody2D.new()
+	add_child_autofree(body)
+
+	var shape = PolyCollisionShape2D.new()
+	shape.build_mode = PolyCollisionShape2D.BUILD_CONVEX
+
+	var square = PoolVector2Array([Vector2(0, 0), Vector2(32, 0), Vector2(32, 32), Vector2(0, 32)])
+	var a = PolyNode2D.new()
+	a.points = square
+	shape.add_child(a)
+	var b = PolyNode2D.new()
+	b.points = square
+	b.position = Vector2(100, 0)
+	shape.add_child(b)
+
+	body.add_child(shape)
+	yield(shape, "shapes_applied")
+	assert_eq(body.shape_owner_get_shape_count(0), 2)
+	var before = [body.shape_owner_get_shape(0, 0), body.shape_owner_get_shape(0, 1)]
+
+	b.position = Vector2(100, 100)
+	yield(shape, "shapes_applied")
+	assert_eq(body.shape_owner_get_shape_count(0), 2)
+	var after = [body.shape_owner_get_shape(0, 0), body.shape_owner_get_shape(0, 1)]
+	assert_eq(after, before, "Shapes should be reused.")